@@ -0,0 +1,78 @@
+#include "chess.h"
+#include <iostream>
+#include <cmath>
+
+// reproducible benchmark and strength-testing harness, the gate every engine change has to pass before it lands
+
+// the curated benchmark positions: the starting position, tactical middlegames and a pawn endgame
+static const std::string BENCHMARK_POSITIONS[] = {
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+        "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+        "8/8/1p1k4/p2p1p2/P2P1P2/1P2K3/8/8 w - - 0 1"};
+
+// searches every benchmark position at the given fixed depth and prints time-to-depth and nodes per second for each
+void Chess::RunBenchmark(const unsigned short &depth) noexcept {
+    unsigned long long total_nodes = 0;
+    long long total_time = 0;
+    for(const auto &fen : BENCHMARK_POSITIONS) {
+        PathNode::ClearTranspositionTable();		// every position starts cold so runs stay comparable across engine versions
+        Chess c("White", depth, "Black", depth, fen);
+        unsigned short search_depth = depth;
+        PathNode root;
+        const Move &best_move = root.AlphaBetaRoot(c, search_depth);
+        const SearchStats &stats = PathNode::GetSearchStats();
+        total_nodes += stats.nodes;
+        total_time += stats.elapsed_ms;
+        std::cout << fen << std::endl << "    best " << best_move.ToText() << ", " << stats.nodes << " nodes in " << stats.elapsed_ms
+                  << " ms (" << (stats.elapsed_ms ? 1000*stats.nodes/stats.elapsed_ms : stats.nodes) << " nodes/second)" << std::endl;
+    }
+    std::cout << "Depth " << depth << ": " << total_nodes << " nodes in " << total_time
+              << " ms (" << (total_time ? 1000*total_nodes/total_time : total_nodes) << " nodes/second)" << std::endl;
+}
+
+// plays paired games between configurations A and B from shared random openings and reports A's score with a confidence interval
+void Chess::PlayMatch(const unsigned short &number_of_pairs) noexcept {
+    unsigned short a_wins = 0, b_wins = 0, draws = 0;
+    Chess c("A", MATCH_A_DIFFICULTY, "B", MATCH_B_DIFFICULTY);
+    for(unsigned short pair=0;pair<number_of_pairs;++pair) {
+        std::string opening;
+        do {		// both games of a pair start from the same short random opening, so neither side's strength hides behind the openings drawn
+            c.Reset(false);
+            for(short ply=0;ply<4;++ply)
+                c.MovePiece(c.GetRandomMove(), false, false);
+            opening = c.ToFEN();
+        } while(c.DetectEndgame() != ONGOING);		// a fool's mate already decided the game, draw a fresh opening
+        for(unsigned short game=0;game<2;++game) {
+            const bool &a_is_white = game == 0;		// the second game of the pair swaps the colors
+            PathNode::ClearTranspositionTable();	// each game starts cold, a warm table would hand the shallower side the deeper side's results
+            c.Reset(false);
+            c.SetPosition(opening);
+            Endgame end_game;
+            do {
+                unsigned short depth = c.whites_turn == a_is_white ? MATCH_A_DIFFICULTY : MATCH_B_DIFFICULTY;
+                PathNode root;
+                c.MovePiece(root.AlphaBetaRoot(c, depth), false, false);
+                end_game = c.DetectEndgame();
+            } while(end_game == ONGOING);
+            if(end_game == CHECKMATE)
+                ++(c.whites_turn == a_is_white ? b_wins : a_wins);		// after the mating move it is the loser's turn
+            else
+                ++draws;
+        }
+    }
+    const unsigned short &games = 2 * number_of_pairs;
+    const double &score = (a_wins + 0.5*draws) / games;
+    const double &interval = 1.96 * sqrt(score * (1.0-score) / games);		// 95% normal-approximation interval of the score
+    std::cout << "A vs B (depth " << MATCH_A_DIFFICULTY << " vs " << MATCH_B_DIFFICULTY << "): +" << a_wins << " -" << b_wins
+              << " =" << draws << " over " << games << " games" << std::endl;
+    std::cout << "A scored " << 100*score << "% (95% interval " << 100*(score-interval) << "% to " << 100*(score+interval) << "%)" << std::endl;
+    if(score - interval > 0.5)
+        std::cout << "A is significantly stronger" << std::endl;
+    else if(score + interval < 0.5)
+        std::cout << "B is significantly stronger" << std::endl;
+    else
+        std::cout << "No significant strength difference" << std::endl;
+}
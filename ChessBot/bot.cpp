@@ -1,26 +1,69 @@
-#include "chess.h"
-
-// bot class implementation
-
-// bot class constructor
-Bot::Bot(const std::string &name, const unsigned short &difficulty) noexcept : Player(name), difficulty(difficulty) {	}
-
-// getter method, returns the difficulty level of the bot
-unsigned short Bot::GetDifficulty() const noexcept {
-    return difficulty;
-}
-
-// returns the optimal move the bot can make with the default difficulty level (according to alpha-beta pruning at least)
-std::string Bot::GetIdealMove(Chess &c) noexcept {
-    return root.AlphaBetaRoot(c, difficulty);
-}
-
-// function overload, returns the optimal move the bot can make with the given difficulty level
-std::string Bot::GetIdealMove(Chess &c, unsigned short difficulty) noexcept {
-    return root.AlphaBetaRoot(c, difficulty);
-}
-
-// operator overload for '=='
-bool Bot::operator== (const Bot &b) const noexcept {
-    return !name.compare(b.name);
+#include "chess.h"
+#include <algorithm>
+#include <iostream>
+
+// bot class implementation
+
+// the opening book shared by both bots, mapped once and only read afterwards
+static OpeningBook opening_book(BOOK_FILE);
+
+// prints one line of statistics describing the search that produced the given move
+static void PrintSearchInfo(const Move &move) noexcept {
+    const SearchStats &stats = PathNode::GetSearchStats();
+    std::cout << "info move " << move.ToText() << " depth " << stats.max_depth << " nodes " << stats.nodes
+              << " evals " << stats.evaluations << " cutoffs " << stats.beta_cutoffs
+              << " first " << (stats.beta_cutoffs ? 100*stats.first_move_cutoffs/stats.beta_cutoffs : 0)
+              << "% tthits " << stats.tt_hits << " time " << stats.elapsed_ms
+              << " ms nps " << (stats.elapsed_ms ? 1000*stats.nodes/stats.elapsed_ms : stats.nodes) << std::endl;
+}
+
+// returns the book move for the current position, or an empty move when the book has none
+static Move GetBookMove(Chess &c) noexcept {
+    const Move &book_move = opening_book.Probe(c.GetZobristKey(), c.GetRandomGenerator());
+    if(book_move.data) {
+        const auto &all_moves = c.AllMoves();		// guards against hash collisions mapping to a foreign position's move
+        const auto &found = std::find(all_moves.begin(), all_moves.end(), book_move);
+        if(found != all_moves.end())
+            return *found;
+    }
+    return Move();
+}
+
+// bot class constructor
+Bot::Bot(const std::string &name, const unsigned short &difficulty) noexcept : Player(name), difficulty(difficulty) {	}
+
+// getter method, returns the difficulty level of the bot
+unsigned short Bot::GetDifficulty() const noexcept {
+    return difficulty;
+}
+
+// returns the optimal move the bot can make with the default difficulty level (according to alpha-beta pruning at least)
+Move Bot::GetIdealMove(Chess &c) noexcept {
+    if(OPENING_BOOK) {
+        const Move &book_move = GetBookMove(c);
+        if(book_move.data)
+            return book_move;		// a book probe costs microseconds, the search would spend the whole move budget
+    }
+    const Move &move = MOVE_TIME_MS ? root.IterativeDeepening(c, MOVE_TIME_MS) : root.AlphaBetaRoot(c, difficulty);
+    if(SEARCH_INFO)
+        PrintSearchInfo(move);
+    return move;
+}
+
+// function overload, returns the optimal move the bot can make with the given difficulty level
+Move Bot::GetIdealMove(Chess &c, unsigned short difficulty) noexcept {
+    if(OPENING_BOOK) {
+        const Move &book_move = GetBookMove(c);
+        if(book_move.data)
+            return book_move;
+    }
+    const Move &move = MOVE_TIME_MS ? root.IterativeDeepening(c, MOVE_TIME_MS) : root.AlphaBetaRoot(c, difficulty);
+    if(SEARCH_INFO)
+        PrintSearchInfo(move);
+    return move;
+}
+
+// operator overload for '=='
+bool Bot::operator== (const Bot &b) const noexcept {
+    return !name.compare(b.name);
 }
\ No newline at end of file
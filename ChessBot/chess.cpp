@@ -1,898 +1,1141 @@
-#include "chess.h"
-#include <iostream>
-#include <algorithm>
-#include <conio.h>
-#include <windows.h>
-
-// function definitions
-
-// moves the cursor to a different (x, y) location on the terminal
-void MoveCursorToXY(const short &x, const short &y) noexcept {
-    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), (COORD){x, y});
-}
-
-// returns the given string in lowercase
-std::string ToLowerString(std::string s) noexcept {
-    transform(s.begin(), s.end(), s.begin(), [](const unsigned char &c){ return tolower(c); });
-    return s;
-}
-
-// returns a random number between "min" and "max"
-template<class T> T GetRandomNumber(const T &min, const T &max) noexcept {
-    return min + T(static_cast<double>(rand()) / static_cast<double>(RAND_MAX+1.0) * (max-min+1));
-}
-
-
-
-// chess class implementation
-
-// constructor of chess class
-Chess::Chess(const std::string &player1, const unsigned short &difficulty1, const std::string &player2, const unsigned short &difficulty2) noexcept
-        : white(player1, difficulty1), black(player2, difficulty2) {
-    CopyBoard(STARTING_BOARD, board);
-}
-
-// checks whether the given coordinate is within board boundaries or not
-bool Chess::WithinBounds(const short &coord) noexcept {
-    return coord>=0 && coord<BOARD_SIZE;
-}
-
-// changes the given board coordinates from ASCII to numerical, e.g. ('d', '3') -> (3, 5)
-void Chess::ChangeToRealCoordinates(char &x1, char &y1, char &x2, char &y2) noexcept {
-    x1 -= 'a', x2 -= 'a';
-    y1 = '8'-y1, y2 = '8'-y2;
-}
-
-// changes the given board coordinates from numerical to ASCII, e.g. (3, 5) -> ('d', '3')
-void Chess::ChangeToString(char &x1, char &y1, char &x2, char &y2) noexcept {
-    x1 += 'a', x2 += 'a';
-    y1 = '8'-y1, y2 = '8'-y2;
-}
-
-// returns the given numerical board coordinates as a string
-std::string Chess::ToString(const short &x1, const short &y1, const short &x2, const short &y2) noexcept {
-    return {static_cast<char>(x1+'a'), static_cast<char>('8'-y1), static_cast<char>(x2+'a'), static_cast<char>('8'-y2)};
-}
-
-// returns the name that is displayed on the terminal for the given piece
-std::string Chess::PieceNameToString(const char &piece) noexcept {
-    switch(piece) {
-        case W_PAWN:	return "W_PAWN";
-        case B_PAWN:	return "B_PAWN";
-        case W_ROOK:	return "W_ROOK";
-        case B_ROOK:	return "B_ROOK";
-        case W_KNIGHT:	return "W_KNIGHT";
-        case B_KNIGHT:	return "B_KNIGHT";
-        case W_BISHOP:	return "W_BISHOP";
-        case B_BISHOP:	return "B_BISHOP";
-        case W_QUEEN:	return "W_QUEEN";
-        case B_QUEEN:	return "B_QUEEN";
-        case W_KING:	return "W_KING";
-        case B_KING:	return "B_KING";
-        default:		return "";
-    }
-}
-
-// returns the worth of the given piece in terms of points
-float Chess::EvaluatePiece(const char &piece) noexcept {
-    switch(piece) {
-        case W_PAWN:
-        case B_PAWN:	return 10;		// pawn: 10 points
-        case W_ROOK:
-        case B_ROOK:	return 50;		// rook: 50 points
-        case W_KNIGHT:
-        case B_KNIGHT:
-        case W_BISHOP:
-        case B_BISHOP:	return 30;		// knight and bishop: 30 points
-        case W_QUEEN:
-        case B_QUEEN:	return 90;		// queen: 90 points
-        case W_KING:
-        case B_KING:	return 900;		// king: 900 points, but you can assume it is infinite
-        default:		return 0;
-    }
-}
-
-// clears all available moves from the terminal
-void Chess::ClearAllMoves(const unsigned short &n) noexcept {
-    MoveCursorToXY(0, DOWN + 3*BOARD_SIZE + 9);
-    for(unsigned short i=0;i<n;++i)
-        std::cout << CLEAR_LINE << std::endl;
-}
-
-// prints the vertical seperators for the game board on the terminal
-void Chess::PrintSeparator(const char &ch) noexcept {
-    for(unsigned short i=1;i<BOARD_SIZE;++i)
-        std::cout << std::string(BOX_WIDTH, ch) << "|";
-    std::cout << std::string(BOX_WIDTH, ch) << std::endl << TO_RIGHT;
-}
-
-// copies the board contents of "from" to "to"
-void Chess::CopyBoard(const char from[BOARD_SIZE][BOARD_SIZE], char to[BOARD_SIZE][BOARD_SIZE]) noexcept {
-    std::copy(*from, *from + BOARD_SIZE*BOARD_SIZE, *to);
-}
-
-// checks whether the board positions of the given two boards are equal or not
-bool Chess::AreBoardsEqual(const char board1[BOARD_SIZE][BOARD_SIZE], const char board2[BOARD_SIZE][BOARD_SIZE]) noexcept {
-    return std::equal(*board1, *board1 + BOARD_SIZE*BOARD_SIZE, *board2);
-}
-
-bool Chess::CanMovePiece(const short &x1, const short &y1, const short &x2, const short &y2, const std::forward_list<std::string> &all_moves) noexcept {
-    return std::find(all_moves.cbegin(), all_moves.cend(), ToString(x1, y1, x2, y2)) != all_moves.cend();
-}
-
-// getter method, returns the piece located in the given x and y coordinates
-char Chess::GetPiece(const short &x, const short &y) const noexcept {
-//	CheckCoordinates(x, y, "GetPiece");
-    return board[y][x];
-}
-
-// getter method, returns whether it's team white's turn or not
-bool Chess::GetTurn() const noexcept {
-    return whites_turn;
-}
-
-// returns a reference to the player object
-Bot& Chess::GetCurrentPlayer() noexcept {
-    return whites_turn ? white : black;
-}
-
-// returns a copy of the player object
-Bot Chess::GetCurrentPlayerConst() const noexcept {
-    return whites_turn ? white : black;
-}
-
-// returns a reference to the player object
-Bot& Chess::GetOtherPlayer() noexcept {
-    return whites_turn ? black : white;
-}
-
-// returns a copy of the player object
-Bot Chess::GetOtherPlayerConst() const noexcept {
-    return whites_turn ? black : white;
-}
-
-// changes whose turn it is so the other player can make its move
-void Chess::ChangeTurn() noexcept {
-    whites_turn = !whites_turn;
-}
-
-// appends the last made game move to "all_game_moves" list
-void Chess::AppendToAllGameMoves(const short &x1, const short &y1, const short &x2, const short &y2) noexcept {
-    if(GetCurrentPlayerConst().GetCastling() && (board[y1][x1] == B_KING + 7*whites_turn) && (x2 == 2 || x2 == 6))
-        all_game_moves.emplace_back(CASTLING, std::string(1, x2));
-    else
-        all_game_moves.emplace_back(NORMAL, ToString(x1, y1, x2, y2) + board[y1][x1] + board[y2][x2]);
-}
-
-// resets the game, everything is back to its default value
-void Chess::Reset() noexcept {
-    CopyBoard(STARTING_BOARD, board);
-    white.Reset();
-    black.Reset();
-    all_game_moves.clear();
-    whites_turn = true;
-    moves_after_last_pawn_move_or_capture = 0;
-    system("cls");
-}
-
-// a function for exception handling, checks whether the given coordinates is within board boundaries or not
-void Chess::CheckCoordinates(const short &x, const short &y, const std::string &func_name) const noexcept(false) {
-    try {
-        if(!WithinBounds(x))		throw x;
-        if(!WithinBounds(y))		throw y;
-    }
-    catch(const short &coord) {
-        std::cerr << std::endl << std::endl << TO_RIGHT << "!ERROR!\t\tInvalid coordinate: '" << coord << "'.\t\t!ERROR!";
-        std::cerr << std::endl << TO_RIGHT << "      \t\tException occurred in \"" << func_name << "\".";
-        PrintAllMovesMadeInOrder();
-        exit(1);
-    }
-}
-
-// prints game over message to the terminal
-bool Chess::EndGameText(const unsigned short &n, const Endgame &end_game) const noexcept {
-    ClearAllMoves(n);
-    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 7);
-    switch(end_game) {
-        case CHECKMATE:
-            std::cout << "!!!Checkmate!!!" << CLEAR_LINE << std::endl << TO_RIGHT << GetOtherPlayerConst().GetName() << " wins!";
-            return true;
-        default:
-            std::cout << "!!!Draw!!!" << CLEAR_LINE << std::endl << TO_RIGHT;
-            switch(end_game) {
-                case FIFTY_MOVES:
-                    std::cout << "Fifty-move rule: No capture has been made and no pawn has been moved in the last 50 moves.";
-                    return true;
-                case THREEFOLD_REP:
-                    std::cout << "Threefold repetition: Last position occured 3 times during the game.";
-                    return true;
-                default:
-                    return false;
-            }
-    }
-}
-
-// returns the x coordinate of the eaten pawn piece
-short Chess::GetEnPassant(const short &x, const short &y) const noexcept {
-    if(all_game_moves.empty())
-        return -1;
-    if(all_game_moves.back().first != NORMAL)
-        return -1;
-    auto last_move = all_game_moves.back().second;
-    ChangeToRealCoordinates(last_move[0], last_move[1], last_move[2], last_move[3]);
-    return ((last_move[4] == W_PAWN - 7*whites_turn) && (abs(last_move[0] - x) == 1) && (last_move[3]-last_move[1] == 2*(whites_turn ? 1 : -1)) && (y == 4 - whites_turn)) ? last_move[0] : -1;
-}
-
-// returns the x coordinate of the en passant move
-template<class Iterator> short Chess::GetEnPassant(const char board[BOARD_SIZE][BOARD_SIZE], const Iterator &it) const noexcept {
-    if(it->first != NORMAL)
-        return -1;
-    auto last_move = it->second;
-    ChangeToRealCoordinates(last_move[0], last_move[1], last_move[2], last_move[3]);
-    for(short x=0;x<BOARD_SIZE;++x)
-        if(board[3 + whites_turn][x] == W_PAWN - 7*whites_turn)
-            if((last_move[4] == B_PAWN + 7*whites_turn) && (abs(last_move[0] - x) == 1) && (last_move[3] - last_move[1] == 2*(whites_turn ? -1 : 1)))
-                return last_move[0];
-    return -1;
-}
-
-// returns true if threefold repetition occurs, false otherwise
-bool Chess::ThreefoldRepetition() const noexcept {
-    static char prev_board[BOARD_SIZE][BOARD_SIZE];
-    CopyBoard(board, prev_board);
-    unsigned short position_count = 1;
-    auto it = all_game_moves.crbegin();
-    auto last_move = it->second;
-    while(true) {
-        for(unsigned short i=0;i<2;++i)	{
-            switch(it->first) {
-                case CASTLING:
-                    return false;		// if a pawn has moved or a castling/capture has occured, then that board position is unique and repetition is not possible
-                default:
-                    if(last_move[4] == W_PAWN || last_move[4] == B_PAWN || last_move[5] != EMPTY)
-                        return false;
-                    ChangeToRealCoordinates(last_move[0], last_move[1], last_move[2], last_move[3]);
-                    prev_board[short(last_move[1])][short(last_move[0])] = last_move[4], prev_board[short(last_move[3])][short(last_move[2])] = EMPTY;
-                    if(it->first == EN_PASSANT)
-                        prev_board[short(last_move[1])][short(last_move[2])] = i == whites_turn ? B_PAWN : W_PAWN;
-            }
-            if((++it) == all_game_moves.crend())
-                return false;
-            last_move = it->second;
-        }
-        if(AreBoardsEqual(prev_board, board))		// check for castling and en passant in every 2 turns
-            if(GetOtherPlayerConst().GetCastling() == (it->first == CASTLING ? false : last_move[6 + (it->first == PROMOTION)]))
-                if((all_game_moves.size() > 1 ? GetEnPassant(board, prev(all_game_moves.cend(), 2)) : -1)
-                   == (next(it) == all_game_moves.crend() ? -1 : GetEnPassant(prev_board, next(it))))
-                    if((++position_count) == 3)
-                        return true;
-    }
-}
-
-// returns true if the player's king is in check, false otherwise
-bool Chess::IsCheck(const bool &turn) const noexcept {
-    short x = -1, y = -1;
-    for(short i=0;x==-1;++i)
-        for(short j=0;j<BOARD_SIZE;++j)
-            if(board[j][i] == B_KING + 7*turn) {
-                x = i, y = j;
-                break;
-            }
-    for(short i=x+1;i<BOARD_SIZE;++i)						// check queen and rook
-        if(board[y][i] == W_ROOK - 7*turn)			return true;
-        else if(board[y][i] == W_QUEEN - 7*turn)	return true;
-        else if(board[y][i] != EMPTY)	break;
-    for(short i=x-1;i>=0;--i)
-        if(board[y][i] == W_ROOK - 7*turn)			return true;
-        else if(board[y][i] == W_QUEEN - 7*turn)	return true;
-        else if(board[y][i] != EMPTY)	break;
-    for(short i=y+1;i<BOARD_SIZE;++i)
-        if(board[i][x] == W_ROOK - 7*turn)			return true;
-        else if(board[i][x] == W_QUEEN - 7*turn)	return true;
-        else if(board[i][x] != EMPTY)	break;
-    for(short i=y-1;i>=0;--i)
-        if(board[i][x] == W_ROOK - 7*turn)			return true;
-        else if(board[i][x] == W_QUEEN - 7*turn)	return true;
-        else if(board[i][x] != EMPTY)	break;
-    for(short i=x-1, j=y-1; i>=0 && j>=0; --i, --j)			// check queen and bishop
-        if(board[j][i] == W_BISHOP - 7*turn)		return true;
-        else if(board[j][i] == W_QUEEN - 7*turn)	return true;
-        else if(board[j][i] != EMPTY)	break;
-    for(short i=x-1, j=y+1; i>=0 && j<BOARD_SIZE; --i, ++j)
-        if(board[j][i] == W_BISHOP - 7*turn)		return true;
-        else if(board[j][i] == W_QUEEN - 7*turn)	return true;
-        else if(board[j][i] != EMPTY)	break;
-    for(short i=x+1, j=y-1; i<BOARD_SIZE && j>=0; ++i, --j)
-        if(board[j][i] == W_BISHOP - 7*turn)		return true;
-        else if(board[j][i] == W_QUEEN - 7*turn)	return true;
-        else if(board[j][i] != EMPTY)	break;
-    for(short i=x+1, j=y+1; i<BOARD_SIZE && j<BOARD_SIZE; ++i, ++j)
-        if(board[j][i] == W_BISHOP - 7*turn)		return true;
-        else if(board[j][i] == W_QUEEN - 7*turn)	return true;
-        else if(board[j][i] != EMPTY)	break;
-    for(short i=x-1;i<x+2;++i)								// check king
-        for(short j=y-1;j<y+2;++j)
-            if((board[j][i] == W_KING - 7*turn) && WithinBounds(i) && WithinBounds(j))			return true;
-    if((board[y-1][x-2] == W_KNIGHT - 7*turn) && (y > 0) && (x > 1))							return true;	// check knight
-    else if((board[y-1][x+2] == W_KNIGHT - 7*turn) && (y > 0) && (x < BOARD_SIZE-2))			return true;
-    else if((board[y+1][x-2] == W_KNIGHT - 7*turn) && (y < BOARD_SIZE-1) && (x > 1))			return true;
-    else if((board[y+1][x+2] == W_KNIGHT - 7*turn) && (y < BOARD_SIZE-1) && (x < BOARD_SIZE-2))	return true;
-    else if((board[y-2][x-1] == W_KNIGHT - 7*turn) && (y > 1) && (x > 0))						return true;
-    else if((board[y-2][x+1] == W_KNIGHT - 7*turn) && (y > 1) && (x < BOARD_SIZE-1))			return true;
-    else if((board[y+2][x-1] == W_KNIGHT - 7*turn) && (y < BOARD_SIZE-2) && (x > 0))			return true;
-    else if((board[y+2][x+1] == W_KNIGHT - 7*turn) && (y < BOARD_SIZE-2) && (x < BOARD_SIZE-1))	return true;
-    else if((board[y + (turn ? -1 : 1)][x+1] == W_PAWN - 7*turn) && (x < BOARD_SIZE-1))			return true;	// check pawn
-    else if((board[y + (turn ? -1 : 1)][x-1] == W_PAWN - 7*turn) && (x > 0))					return true;
-    return false;
-}
-
-// function overload, returns true if the player's king is in check, false otherwise
-bool Chess::IsCheck(std::string &move) noexcept {
-    ChangeToRealCoordinates(move[0], move[1], move[2], move[3]);
-    MovePiece(move[0], move[1], move[2], move[3], false, false);
-    const bool &is_check = IsCheck(!whites_turn);
-    MovePieceBack(move[0], move[1], move[2], move[3]);
-    ChangeToString(move[0], move[1], move[2], move[3]);
-    return is_check;
-}
-
-// returns a list of all possible moves the pawn located in (x, y) can make
-std::forward_list<std::string> Chess::PawnMoves(const short &x, const short &y) const noexcept {
-    const auto &IsValid = whites_turn ? [](const char &ch){ return ch < 0; } : [](const char &ch){ return ch > 0; };
-    const short &inc = whites_turn ? -1 : 1;
-    std::forward_list<std::string> all_moves;
-    if(board[y+inc][x] == EMPTY) {
-        all_moves.emplace_front(ToString(x, y, x, y+inc));				// 1 square forward
-        if((y == 1 + 5*whites_turn) && (board[y + 2*inc][x] == EMPTY))
-            all_moves.emplace_front(ToString(x, y, x, y + 2*inc));		// 2 squares forward
-    }
-    if(GetEnPassant(x, y) != -1)
-        all_moves.emplace_front(ToString(x, y, GetEnPassant(x, y), y+inc));
-    if(IsValid(board[y+inc][x+1]) && (x < BOARD_SIZE-1))
-        all_moves.emplace_front(ToString(x, y, x+1, y+inc));		// diagonal attack moves
-    if(IsValid(board[y+inc][x-1]) && (x > 0))
-        all_moves.emplace_front(ToString(x, y, x-1, y+inc));
-    return all_moves;
-}
-
-// returns a list of all possible moves the rook located in (x, y) can make
-std::forward_list<std::string> Chess::RookMoves(const short &x, const short &y) const noexcept {
-    const auto &IsValid = whites_turn ? [](const char &ch){ return ch < 0; } : [](const char &ch){ return ch > 0; };
-    std::forward_list<std::string> all_moves;
-    for(short i=x+1;i<BOARD_SIZE;++i)			// right
-        if(board[y][i] == EMPTY)
-            all_moves.emplace_front(ToString(x, y, i, y));
-        else {
-            if(IsValid(board[y][i]))
-                all_moves.emplace_front(ToString(x, y, i, y));
-            break;
-        }
-    for(short i=x-1;i>=0;--i)					// left
-        if(board[y][i] == EMPTY)
-            all_moves.emplace_front(ToString(x, y, i, y));
-        else {
-            if(IsValid(board[y][i]))
-                all_moves.emplace_front(ToString(x, y, i, y));
-            break;
-        }
-    for(short i=y+1;i<BOARD_SIZE;++i)			// down
-        if(board[i][x] == EMPTY)
-            all_moves.emplace_front(ToString(x, y, x, i));
-        else {
-            if(IsValid(board[i][x]))
-                all_moves.emplace_front(ToString(x, y, x, i));
-            break;
-        }
-    for(short i=y-1;i>=0;--i)					// up
-        if(board[i][x] == EMPTY)
-            all_moves.emplace_front(ToString(x, y, x, i));
-        else {
-            if(IsValid(board[i][x]))
-                all_moves.emplace_front(ToString(x, y, x, i));
-            break;
-        }
-    return all_moves;
-}
-
-// returns a list of all possible moves the knight located in (x, y) can make
-std::forward_list<std::string> Chess::KnightMoves(const short &x, const short &y) const noexcept {
-    const auto &IsValid = whites_turn ? [](const char &ch){ return ch <= 0; } : [](const char &ch){ return ch >= 0; };
-    std::forward_list<std::string> all_moves;
-    if(IsValid(board[y-1][x-2]) && (y > 0) && (x > 1))
-        all_moves.emplace_front(ToString(x, y, x-2, y-1));
-    if(IsValid(board[y-1][x+2]) && (y > 0) && (x < BOARD_SIZE-2))
-        all_moves.emplace_front(ToString(x, y, x+2, y-1));
-    if(IsValid(board[y+1][x-2]) && (y < BOARD_SIZE-1) && (x > 1))
-        all_moves.emplace_front(ToString(x, y, x-2, y+1));
-    if(IsValid(board[y+1][x+2]) && (y < BOARD_SIZE-1) && (x < BOARD_SIZE-2))
-        all_moves.emplace_front(ToString(x, y, x+2, y+1));
-    if(IsValid(board[y-2][x-1]) && (y > 1) && (x > 0))
-        all_moves.emplace_front(ToString(x, y, x-1, y-2));
-    if(IsValid(board[y-2][x+1]) && (y > 1) && (x < BOARD_SIZE-1))
-        all_moves.emplace_front(ToString(x, y, x+1, y-2));
-    if(IsValid(board[y+2][x-1]) && (y < BOARD_SIZE-2) && (x > 0))
-        all_moves.emplace_front(ToString(x, y, x-1, y+2));
-    if(IsValid(board[y+2][x+1]) && (y < BOARD_SIZE-2) && (x < BOARD_SIZE-1))
-        all_moves.emplace_front(ToString(x, y, x+1, y+2));
-    return all_moves;
-}
-
-// returns a list of all possible moves the bishop located in (x, y) can make
-std::forward_list<std::string> Chess::BishopMoves(const short &x, const short &y) const noexcept {
-    const auto &IsValid = whites_turn ? [](const char &ch){ return ch < 0; } : [](const char &ch){ return ch > 0; };
-    std::forward_list<std::string> all_moves;
-    for(short i=x-1, j=y-1; i>=0 && j>=0; --i, --j)						// upper left diagonal
-        if(board[j][i] == EMPTY)
-            all_moves.emplace_front(ToString(x, y, i, j));
-        else {
-            if(IsValid(board[j][i]))
-                all_moves.emplace_front(ToString(x, y, i, j));
-            break;
-        }
-    for(short i=x-1, j=y+1; i>=0 && j<BOARD_SIZE; --i, ++j)				// lower left diagonal
-        if(board[j][i] == EMPTY)
-            all_moves.emplace_front(ToString(x, y, i, j));
-        else {
-            if(IsValid(board[j][i]))
-                all_moves.emplace_front(ToString(x, y, i, j));
-            break;
-        }
-    for(short i=x+1, j=y-1; i<BOARD_SIZE && j>=0; ++i, --j)				// upper right diagonal
-        if(board[j][i] == EMPTY)
-            all_moves.emplace_front(ToString(x, y, i, j));
-        else {
-            if(IsValid(board[j][i]))
-                all_moves.emplace_front(ToString(x, y, i, j));
-            break;
-        }
-    for(short i=x+1, j=y+1; i<BOARD_SIZE && j<BOARD_SIZE; ++i, ++j)		// lower right diagonal
-        if(board[j][i] == EMPTY)
-            all_moves.emplace_front(ToString(x, y, i, j));
-        else {
-            if(IsValid(board[j][i]))
-                all_moves.emplace_front(ToString(x, y, i, j));
-            break;
-        }
-    return all_moves;
-}
-
-// returns a list of all possible moves the queen located in (x, y) can make
-std::forward_list<std::string> Chess::QueenMoves(const short &x, const short &y) const noexcept {
-    auto all_moves = RookMoves(x, y);			// queen = rook + bishop
-    all_moves.merge(BishopMoves(x, y));
-    return all_moves;
-}
-
-// returns a list of all possible moves the king located in (x, y) can make
-std::forward_list<std::string> Chess::KingMoves(const short &x, const short &y) const noexcept {
-    const auto &IsValid = whites_turn ? [](const char &ch){ return ch <= 0; } : [](const char &ch){ return ch >= 0; };
-    std::forward_list<std::string> all_moves;
-    for(short i=x-1;i<x+2;++i)		// add moves within 1 square reach
-        for(short j=y-1;j<y+2;++j)
-            if(IsValid(board[j][i]) && WithinBounds(i) && WithinBounds(j))
-                all_moves.emplace_front(ToString(x, y, i, j));
-    if(GetCurrentPlayerConst().GetCastling())		// add castling moves if castling is possible
-        if(!IsCheck(whites_turn)) {
-            const short &line = (BOARD_SIZE-1)*whites_turn;
-            if((board[line][0] == B_ROOK + 7*whites_turn) && board[line][1] == EMPTY && board[line][2] == EMPTY && board[line][3] == EMPTY)
-                all_moves.emplace_front(ToString(4, line, 2, line));	// long castling
-            else if((board[line][7] == B_ROOK + 7*whites_turn) && board[line][5] == EMPTY && board[line][6] == EMPTY)
-                all_moves.emplace_front(ToString(4, line, 6, line));	// short castling
-        }
-    return all_moves;
-}
-
-// returns a list of all possible moves the player can make
-std::forward_list<std::string> Chess::AllMoves() noexcept {
-    std::forward_list<std::string> all_moves;
-    for(short y=0;y<BOARD_SIZE;++y)
-        for(short x=0;x<BOARD_SIZE;++x) {
-            if((board[y][x] < 0) == whites_turn)
-                continue;
-            switch(board[y][x]) {
-                case W_PAWN:
-                case B_PAWN:
-                    all_moves.merge(PawnMoves(x, y));
-                    break;
-                case W_ROOK:
-                case B_ROOK:
-                    all_moves.merge(RookMoves(x, y));
-                    break;
-                case W_KNIGHT:
-                case B_KNIGHT:
-                    all_moves.merge(KnightMoves(x, y));
-                    break;
-                case W_BISHOP:
-                case B_BISHOP:
-                    all_moves.merge(BishopMoves(x, y));
-                    break;
-                case W_QUEEN:
-                case B_QUEEN:
-                    all_moves.merge(QueenMoves(x, y));
-                    break;
-                case W_KING:
-                case B_KING:
-                    all_moves.merge(KingMoves(x, y));
-            }
-        }
-    for(auto it = all_moves.begin(), prev = all_moves.before_begin(); it != all_moves.cend();)		// if the possible move makes me checkmate after the opponent's turn, remove it from the list
-        if(IsCheck(*it))
-            it = all_moves.erase_after(prev);
-        else
-            ++it, ++prev;
-    return all_moves;
-}
-
-// returns a random move the player can make
-std::string Chess::GetRandomMove() noexcept {
-    auto all_moves = AllMoves();
-    auto move = all_moves.begin();
-    advance(move, GetRandomNumber<unsigned short>(0, distance(all_moves.cbegin(), all_moves.cend()) - 1));
-    ChangeToRealCoordinates((*move)[0], (*move)[1], (*move)[2], (*move)[3]);
-    return *move;
-}
-
-// asks the player it's choice of promotion, then promotes the pawn to the desired piece
-void Chess::ManuallyPromotePawn(const short &x, const short &y) noexcept {
-    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 7);
-    std::cout << "Enter your choice of promotion [(r)ook, (k)night, (b)ishop, (q)ueen]";
-    char key = getch();
-    while(true)
-        switch(key = tolower(key)) {
-            case 'r':	board[y][x] = whites_turn ? W_ROOK : B_ROOK;		return;
-            case 'k':	board[y][x] = whites_turn ? W_KNIGHT : B_KNIGHT;	return;
-            case 'b':	board[y][x] = whites_turn ? W_BISHOP : B_BISHOP;	return;
-            case 'q':	board[y][x] = whites_turn ? W_QUEEN : B_QUEEN;		return;
-            default:	key = getch();
-        }
-}
-
-// moves the piece from (x1, y1) to (x2, y2)
-void Chess::MovePiece(const short &x1, const short &y1, const short &x2, const short &y2, const bool &manual_promotion, const bool &update_board) noexcept {
-//	CheckCoordinates(x1, y1, "MovePiece");
-//	CheckCoordinates(x2, y2, "MovePiece");
-    AppendToAllGameMoves(x1, y1, x2, y2);		// similar to FEN notation but not really, the starting and ending points of the moving piece, promoted piece if there is promotion and ability to do castling
-    switch(board[y1][x1]) {
-        case W_PAWN:
-        case B_PAWN:
-            if(y2 == ((BOARD_SIZE-1) * !whites_turn)) {			// check for castling, promotion or en passant
-                if(manual_promotion) {
-                    ManuallyPromotePawn(x1, y1);
-                    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 7);
-                    std::cout << "All possible moves:" << CLEAR_LINE;
-                }
-                else if(whites_turn ? WHITE_BOT_RANDOM : BLACK_BOT_RANDOM)
-                    board[y1][x1] = (whites_turn ? 1 : -1) * GetRandomNumber(2, 5);
-                else
-                    board[y1][x1] = whites_turn ? W_QUEEN : B_QUEEN;
-                all_game_moves.back().first = PROMOTION;
-                all_game_moves.back().second.push_back(board[y1][x1]);
-            }
-            else if(x1 != x2 && board[y2][x2] == EMPTY) {
-                board[y1][x2] = EMPTY;
-                if(update_board) {
-                    GetCurrentPlayer().IncreaseScore(EvaluatePiece(W_PAWN));
-                    UpdateScore(GetCurrentPlayerConst());
-                    UpdateBoard(x2, y1);
-                }
-                all_game_moves.back().first = EN_PASSANT;
-            }
-            break;
-        case W_KING:
-        case B_KING:
-            if(GetCurrentPlayerConst().GetCastling()) {
-                const short &line = (BOARD_SIZE-1) * whites_turn;
-                switch(x2) {
-                    case 2:
-                        board[line][3] = board[line][0], board[line][0] = EMPTY;
-                        if(update_board) {
-                            UpdateBoard(0, line);
-                            UpdateBoard(3, line);
-                        }
-                        break;
-                    case 6:
-                        board[line][5] = board[line][7], board[line][7] = EMPTY;
-                        if(update_board) {
-                            UpdateBoard(7, line);
-                            UpdateBoard(5, line);
-                        }
-                }
-            }
-        case W_ROOK:
-        case B_ROOK:
-            GetCurrentPlayer().SetCastling(false);
-    }
-    if(all_game_moves.back().first != CASTLING)				all_game_moves.back().second.push_back(GetCurrentPlayerConst().GetCastling());
-    board[y2][x2] = board[y1][x1], board[y1][x1] = EMPTY;
-    if(update_board) {
-        if(all_game_moves.back().first != CASTLING)
-            if(all_game_moves.back().second[5] != EMPTY) {
-                GetCurrentPlayer().IncreaseScore(EvaluatePiece(all_game_moves.back().second[5]));
-                UpdateScore(GetCurrentPlayerConst());
-                moves_after_last_pawn_move_or_capture = 0;		// the piece is eaten
-            }
-        UpdateBoard(x1, y1);
-        UpdateBoard(x2, y2);
-    }
-    ChangeTurn();		// it's the opponent's turn
-}
-
-// undoes the move from (x1,y1) to (x2,y2), the opposite of the "MovePiece" function
-void Chess::MovePieceBack(const short &x1, const short &y1, const short &x2, const short &y2) noexcept {
-    ChangeTurn();
-    board[y1][x1] = board[y2][x2], board[y2][x2] = all_game_moves.back().first == CASTLING ? static_cast<char>(EMPTY) : all_game_moves.back().second[5];
-    switch(board[y1][x1]) {
-        case W_PAWN:
-        case B_PAWN:
-            if(x1 != x2 && board[y2][x2] == EMPTY)
-                board[y1][x2] = whites_turn ? B_PAWN : W_PAWN;
-            break;
-        case W_ROOK:
-        case B_ROOK:
-            if(prev(all_game_moves.cend(), 3)->first != CASTLING)
-                if(prev(all_game_moves.cend(), 3)->second[6 + (prev(all_game_moves.cend(), 3)->first == PROMOTION)])
-                    GetCurrentPlayer().SetCastling(true);
-            break;
-        case W_QUEEN:
-        case B_QUEEN:
-            if(all_game_moves.back().first == PROMOTION)
-                board[y1][x1] = whites_turn ? W_PAWN : B_PAWN;
-            break;
-        case W_KING:
-        case B_KING:
-            if(all_game_moves.back().first == CASTLING) {
-                GetCurrentPlayer().SetCastling(true);
-                const short line = (BOARD_SIZE-1) * whites_turn;
-                switch(x2) {
-                    case 2:
-                        board[line][0] = board[line][3], board[line][3] = EMPTY;
-                        break;
-                    case 6:
-                        board[line][7] = board[line][5], board[line][5] = EMPTY;
-                }
-            }
-            else if(prev(all_game_moves.cend(), 3)->first != CASTLING)
-                if(prev(all_game_moves.cend(), 3)->second[6 + (prev(all_game_moves.cend(), 3)->first == PROMOTION)])
-                    GetCurrentPlayer().SetCastling(true);
-    }
-    all_game_moves.pop_back();
-}
-
-// updates the board display on the terminal
-void Chess::UpdateBoard(const short &x, const short &y) const noexcept {
-    const unsigned short &diff = BOX_WIDTH - PieceNameToString(board[y][x]).length();
-    MoveCursorToXY(RIGHT + (BOX_WIDTH+1)*x, DOWN + 3*y + 1);
-    std::cout << std::string(diff/2, ' ') << PieceNameToString(board[y][x]) << std::string(diff/2, ' ');
-    if(diff%2)	std::cout << " ";
-}
-
-// updates the score display on the terminal
-void Chess::UpdateScore(const Bot &p) const noexcept {
-    const unsigned short &dx = p==white ? white.GetName().length() + 2 : (BOX_WIDTH+1)*BOARD_SIZE - 5;
-    MoveCursorToXY(RIGHT+dx, DOWN + 3*BOARD_SIZE + 2);
-    std::cout << std::string(std::to_string(p.GetScore()).length(), ' ');
-    MoveCursorToXY(RIGHT+dx, DOWN + 3*BOARD_SIZE + 2);
-    std::cout << p.GetScore();
-}
-
-// returns the worth of the position of the piece in terms of points
-float Chess::EvaluatePosition(const short &x, const short &y) const noexcept {
-    if(board[y][x] == EMPTY)
-        return 0;
-    static float PIECE_POS_POINTS[6][BOARD_SIZE][BOARD_SIZE] =
-            {{{-3.0, -4.0, -4.0, -5.0, -5.0, -4.0, -4.0, -3.0},		// king
-                     {-3.0, -4.0, -4.0, -5.0, -5.0, -4.0, -4.0, -3.0},
-                     {-3.0, -4.0, -4.0, -5.0, -5.0, -4.0, -4.0, -3.0},
-                     {-3.0, -4.0, -4.0, -5.0, -5.0, -4.0, -4.0, -3.0},
-                     {-2.0, -3.0, -3.0, -4.0, -4.0, -3.0, -3.0, -2.0},
-                     {-1.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -1.0},
-                     {2.0, 2.0, 0.0, 0.0, 0.0, 0.0, 2.0, 2.0},
-                     {2.0, 3.0, 1.0, 0.0, 0.0, 1.0, 3.0, 2.0}}
-                    ,
-             {{-2.0, -1.0, -1.0, -0.5, -0.5, -1.0, -1.0, -2.0},		// queen
-                     {-1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0},
-                     {-1.0, 0.0, 0.5, 0.5, 0.5, 0.5, 0.0, -1.0},
-                     {-0.5, 0.0, 0.5, 0.5, 0.5, 0.5, 0.0, -0.5},
-                     {0.0, 0.0, 0.5, 0.5, 0.5, 0.5, 0.0, -0.5},
-                     {-1.0, 0.5, 0.5, 0.5, 0.5, 0.5, 0.0, -1.0},
-                     {-1.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.0, -1.0},
-                     {-2.0, -1.0, -1.0, -0.5, -0.5, -1.0, -1.0, -2.0}}
-                    ,
-             {{-2.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -2.0},		// bishop
-                     {-1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0},
-                     {-1.0, 0.0, 0.5, 1.0, 1.0, 0.5, 0.0, -1.0},
-                     {-1.0, 0.5, 0.5, 1.0, 1.0, 0.5, 0.5, -1.0},
-                     {-1.0, 0.0, 1.0, 1.0, 1.0, 1.0, 0.0, -1.0},
-                     {-1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, -1.0},
-                     {-1.0, 0.5, 0.0, 0.0, 0.0, 0.0, 0.5, -1.0},
-                     {-2.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -2.0}}
-                    ,
-             {{-5.0, -4.0, -3.0, -3.0, -3.0, -3.0, -4.0, -5.0},		// knight
-                     {-4.0, -2.0, 0.0, 0.0, 0.0, 0.0, -2.0, -4.0},
-                     {-3.0, 0.0, 1.0, 1.5, 1.5, 1.0, 0.0, -3.0},
-                     {-3.0, 0.5, 1.5, 2.0, 2.0, 1.5, 0.5, -3.0},
-                     {-3.0, 0.0, 1.5, 2.0, 2.0, 1.5, 0.0, -3.0},
-                     {-3.0, 0.5, 1.0, 1.5, 1.5, 1.0, 0.5, -3.0},
-                     {-4.0, -2.0, 0.0, 0.5, 0.5, 0.0, -2.0, -4.0},
-                     {-5.0, -4.0, -3.0, -3.0, -3.0, -3.0, -4.0, -5.0}}
-                    ,
-             {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},				// rook
-                     {0.5, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.5},
-                     {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
-                     {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
-                     {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
-                     {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
-                     {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
-                     {0.0, 0.0, 0.0, 0.5, 0.5, 0.0, 0.0, 0.0}}
-                    ,
-             {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},				// pawn
-                     {5.0, 5.0, 5.0, 5.0, 5.0, 5.0, 5.0, 5.0},
-                     {1.0, 1.0, 2.0, 3.0, 3.0, 2.0, 1.0, 1.0},
-                     {0.5, 0.5, 1.0, 2.5, 2.5, 1.0, 0.5, 0.5},
-                     {0.0, 0.0, 0.0, 2.0, 2.0, 0.0, 0.0, 0.0},
-                     {0.5, -0.5, -1.0, 0.0, 0.0, -1.0, -0.5, 0.5},
-                     {0.5, 1.0, 1.0, -2.0, -2.0, 1.0, 1.0, 0.5},
-                     {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}};				// returns negative points if the pieces are black, positive points if the pieces are white
-    return (board[y][x]<0 ? -1 : 1) * (EvaluatePiece(board[y][x]) + PIECE_POS_POINTS[board[y][x] + 7*(board[y][x]<0) - 1][board[y][x]<0 ? BOARD_SIZE-y-1 : y][x]);
-}
-
-// returns the worth of the board position in terms of points
-float Chess::EvaluateBoard(const bool &turn) const noexcept {
-    float total_evaluation = 0.0;
-    for(short y=0;y<BOARD_SIZE;++y)
-        for(short x=0;x<BOARD_SIZE;++x)
-            total_evaluation += EvaluatePosition(x, y);
-    return (turn ? 1 : -1) * total_evaluation;
-}
-
-// prints the game board on the terminal
-void Chess::PrintBoard() const noexcept {
-    std::cout << TO_DOWN << TO_RIGHT;
-    for(short y=0;y<BOARD_SIZE;++y) {
-        PrintSeparator(' ');
-        std::cout << "\b\b\b" << BOARD_SIZE-y << "  ";
-        for(short x=0;x<BOARD_SIZE;++x) {
-            const unsigned short &diff = BOX_WIDTH - PieceNameToString(board[y][x]).length();
-            std::cout << std::string(diff/2, ' ') << PieceNameToString(board[y][x]) << std::string(diff/2, ' ');
-            if(diff%2)				std::cout << " ";
-            if(x < BOARD_SIZE-1)	std::cout << "|";
-        }
-        if(y < BOARD_SIZE-1) {
-            std::cout << std::endl << TO_RIGHT;
-            PrintSeparator('_');
-        }
-    }
-    std::cout << std::endl << TO_RIGHT;
-    PrintSeparator(' ');
-    for(char ch='a';ch<'a'+BOARD_SIZE;++ch)
-        std::cout << std::string(BOX_WIDTH/2, ' ') << ch << std::string(BOX_WIDTH/2, ' ');
-    std::cout << std::endl << std::endl << TO_RIGHT << white.GetName() << ": 0";
-    std::cout << std::string((BOX_WIDTH+1)*BOARD_SIZE - white.GetName().length() - black.GetName().length() - 10, ' ') << black.GetName() << ": 0";
-    std::cout << std::endl << std::endl << TO_RIGHT << white.GetName() << "'s turn...";
-    std::cout << std::endl << TO_RIGHT << "Enter move coordinates (x1,y1)->(x2,y2):";
-    std::cout << std::endl << std::endl << TO_RIGHT << "All possible moves:" << std::endl;
-}
-
-// after the game is over, prints all moves played throughout the game in chronological order
-void Chess::PrintAllMovesMadeInOrder() const noexcept {
-    std::cout << std::endl << std::endl << TO_RIGHT << "All moves made in order:" << std::endl;
-    bool turn = true;
-    for(const auto &game_move : all_game_moves) {
-        std::cout << std::endl << TO_RIGHT << (turn ? white : black).GetName() << ": ";
-        switch(game_move.first) {
-            case CASTLING:
-                std::cout << "castling " << (game_move.second[0] == 2 ? "long" : "short");	break;
-            default:
-                std::cout << ToLowerString(PieceNameToString(game_move.second[4])).substr(2) << " '" << game_move.second.substr(0, 2) << "' to ";
-                if(game_move.second[5] != EMPTY)
-                    std::cout << ToLowerString(PieceNameToString(game_move.second[5])).substr(2) + " ";
-                std::cout << "'" << game_move.second.substr(2, 2) << "'";
-                switch(game_move.first) {
-                    case PROMOTION:
-                        std::cout << " promoted to " << ToLowerString(PieceNameToString(game_move.second[6])).substr(2);
-                        break;
-                    case EN_PASSANT:
-                        std::cout << " (en passant)";
-                    default:
-                        break;
-                }
-        }
-        turn = !turn;
-    }
-}
-
-// checks if the game is over or not
-bool Chess::CheckEndgame(const unsigned short &n) noexcept {
-    if(AllMoves().empty()) {			// if the opponent has no moves left, then it is checkmate
-        GetOtherPlayer().IncreaseScore(EvaluatePiece(W_KING));
-        UpdateScore(GetOtherPlayerConst());
-        return EndGameText(n, CHECKMATE);
-    }
-    else if(all_game_moves.back().first != CASTLING) {
-        if(all_game_moves.back().second[4] == W_PAWN - 7*whites_turn)
-            moves_after_last_pawn_move_or_capture = 0;		// pawn has moved
-        else if(all_game_moves.back().second[5] != EMPTY)
-            moves_after_last_pawn_move_or_capture = 0;		// capture has occured
-        else if((++moves_after_last_pawn_move_or_capture) == 50)
-            return EndGameText(n, FIFTY_MOVES);
-    }
-    else if((++moves_after_last_pawn_move_or_capture) == 50)
-        return EndGameText(n, FIFTY_MOVES);
-    if(ThreefoldRepetition())
-        return EndGameText(n, THREEFOLD_REP);
-    return false;
-}
-
-// lists all possible moves, expects player input and plays the given move if it is valid, expects a valid input otherwise
-bool Chess::PlayersTurn() noexcept {
-    auto all_moves = AllMoves();
-    all_moves.sort();
-    unsigned short i=0;
-    for(const auto &move : all_moves) {
-        if(!((i++)%MOVES_PER_LINE))	std::cout << std::endl;
-        std::cout << TO_RIGHT << move.substr(0, 2) << " " << move.substr(2);
-    }
-    if(IsCheck(whites_turn)) {
-        std::cout << std::endl << std::endl << TO_RIGHT << "Check!";
-        i += 2*MOVES_PER_LINE;
-    }
-    MoveCursorToXY(RIGHT+41, DOWN + 3*BOARD_SIZE + 5);
-    while(true) {
-        std::string from, to;
-        std::cin >> from;
-        if(!ToLowerString(from).compare("quit"))
-            return EndGameText(i/MOVES_PER_LINE + 1, QUIT);
-        if(!ToLowerString(from).compare("exit"))
-            return EndGameText(i/MOVES_PER_LINE + 1, QUIT);
-        std::cin >> to;
-        from.resize(2);
-        to.resize(2);
-        from.shrink_to_fit();
-        to.shrink_to_fit();
-        from[0] = tolower(from[0]), to[0] = tolower(to[0]);
-        ChangeToRealCoordinates(from[0], from[1], to[0], to[1]);
-        if((from[0]!=to[0] || from[1]!=to[1]) && WithinBounds(from[0]) && WithinBounds(from[1]) && WithinBounds(to[0]) && WithinBounds(to[1]))
-            if(CanMovePiece(from[0], from[1], to[0], to[1], all_moves)) {
-                MovePiece(from[0], from[1], to[0], to[1], true, true);
-                if(CheckEndgame(i/MOVES_PER_LINE + 1))
-                    return false;
-                break;
-            }
-        MoveCursorToXY(RIGHT+41, DOWN + 3*BOARD_SIZE + 5);
-        std::cout << CLEAR_LINE << std::endl << CLEAR_LINE;
-        MoveCursorToXY(RIGHT+41, DOWN + 3*BOARD_SIZE + 5);
-    }
-    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 4);
-    std::cout << GetCurrentPlayerConst().GetName() << "'s turn..." << CLEAR_LINE;
-    MoveCursorToXY(RIGHT+41, DOWN + 3*BOARD_SIZE + 5);
-    std::cout << CLEAR_LINE << std::endl << CLEAR_LINE;
-    ClearAllMoves(i/MOVES_PER_LINE + 1);
-    MoveCursorToXY(0, DOWN + 3*BOARD_SIZE + 8);
-    return true;
-}
-
-// plays the bots move
-bool Chess::BotsTurn() noexcept {
-    const auto &move = (whites_turn ? WHITE_BOT_RANDOM : BLACK_BOT_RANDOM) ? GetRandomMove() : GetCurrentPlayer().GetIdealMove(*this);
-    MovePiece(move[0], move[1], move[2], move[3], false, true);
-    if(CheckEndgame())
-        return false;
-    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 4);
-    std::cout << GetCurrentPlayerConst().GetName() << "'s turn..." << CLEAR_LINE;
-    return true;
-}
-
-// prints game over messages and expects user input for another game
-bool Chess::GameOver() noexcept {
-    std::cout << std::endl << std::endl << std::endl << TO_RIGHT << "Press R to play again.";
-    std::cout << std::endl << TO_RIGHT << "Press any other key to quit.";
-    PrintAllMovesMadeInOrder();
-    char key = getch();
-    switch(key = tolower(key)) {
-        case 'r':
-            Reset();
-            return true;
-        default:
-            return false;
-    }
+#include "chess.h"
+#include <iostream>
+#include <algorithm>
+#ifdef _WIN32
+#include <conio.h>
+#include <windows.h>
+#else
+// reads one raw key press, conio.h does not exist outside Windows so line-buffered input has to do
+static char getch() noexcept {
+    return static_cast<char>(std::cin.get());
+}
+#endif
+
+// function definitions
+
+// moves the cursor to a different (x, y) location on the terminal
+void MoveCursorToXY(const short &x, const short &y) noexcept {
+#ifdef _WIN32
+    SetConsoleCursorPosition(GetStdHandle(STD_OUTPUT_HANDLE), (COORD){x, y});
+#else
+    std::cout << "\033[" << y+1 << ";" << x+1 << "H";		// the ANSI escape every non-Windows terminal understands
+#endif
+}
+
+// returns the given string in lowercase
+std::string ToLowerString(std::string s) noexcept {
+    transform(s.begin(), s.end(), s.begin(), [](const unsigned char &c){ return tolower(c); });
+    return s;
+}
+
+// the console renderer shared by every display function, there is only one console
+static Renderer renderer;
+
+// chess class implementation
+
+// precomputed ray masks for each direction and starting square, generated at compile time
+struct RayTables {
+    Bitboard masks[8][BOARD_SIZE*BOARD_SIZE] = {};
+};
+
+// builds the ray masks by walking each of the eight ray directions from every square
+static constexpr RayTables InitRayMasks() noexcept {
+    RayTables tables;
+    constexpr short DX[8] = {1, 0, -1, 1, -1, 0, 1, -1};
+    constexpr short DY[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+    for(short dir=0;dir<8;++dir)
+        for(short y=0;y<BOARD_SIZE;++y)
+            for(short x=0;x<BOARD_SIZE;++x) {
+                Bitboard ray = 0;
+                for(short i=x+DX[dir], j=y+DY[dir]; i>=0 && i<BOARD_SIZE && j>=0 && j<BOARD_SIZE; i+=DX[dir], j+=DY[dir])
+                    ray |= Bitboard(1) << (j*BOARD_SIZE + i);
+                tables.masks[dir][y*BOARD_SIZE + x] = ray;
+            }
+    return tables;
+}
+static constexpr RayTables RAY_TABLES = InitRayMasks();
+static constexpr auto &RAY_MASKS = RAY_TABLES.masks;
+
+// attack masks of the non-sliding pieces for every square, generated at compile time
+struct AttackTables {
+    Bitboard knight[BOARD_SIZE*BOARD_SIZE] = {};
+    Bitboard king[BOARD_SIZE*BOARD_SIZE] = {};
+    Bitboard pawn[2][BOARD_SIZE*BOARD_SIZE] = {};	// capture squares only, indexed by pawn color (0: black, 1: white)
+};
+
+// builds the knight, king and pawn attack masks by walking each piece's offsets from every square
+static constexpr AttackTables InitAttackTables() noexcept {
+    AttackTables tables;
+    constexpr short KNIGHT_DX[8] = {-2, 2, -2, 2, -1, 1, -1, 1};
+    constexpr short KNIGHT_DY[8] = {-1, -1, 1, 1, -2, -2, 2, 2};
+    for(short y=0;y<BOARD_SIZE;++y)
+        for(short x=0;x<BOARD_SIZE;++x) {
+            const short square = y*BOARD_SIZE + x;
+            for(short i=0;i<8;++i)
+                if(x + KNIGHT_DX[i] >= 0 && x + KNIGHT_DX[i] < BOARD_SIZE && y + KNIGHT_DY[i] >= 0 && y + KNIGHT_DY[i] < BOARD_SIZE)
+                    tables.knight[square] |= Bitboard(1) << ((y + KNIGHT_DY[i])*BOARD_SIZE + x + KNIGHT_DX[i]);
+            for(short i=x-1;i<x+2;++i)
+                for(short j=y-1;j<y+2;++j)
+                    if(i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE && (i != x || j != y))
+                        tables.king[square] |= Bitboard(1) << (j*BOARD_SIZE + i);
+            for(short i=-1;i<2;i+=2)
+                if(x+i >= 0 && x+i < BOARD_SIZE) {
+                    if(y > 0)
+                        tables.pawn[1][square] |= Bitboard(1) << ((y-1)*BOARD_SIZE + x+i);	// white pawns capture upwards
+                    if(y < BOARD_SIZE-1)
+                        tables.pawn[0][square] |= Bitboard(1) << ((y+1)*BOARD_SIZE + x+i);	// black pawns capture downwards
+                }
+        }
+    return tables;
+}
+static constexpr AttackTables ATTACK_TABLES = InitAttackTables();
+static constexpr auto &KNIGHT_ATTACKS = ATTACK_TABLES.knight;
+static constexpr auto &KING_ATTACKS = ATTACK_TABLES.king;
+static constexpr auto &PAWN_ATTACKS = ATTACK_TABLES.pawn;
+
+// de Bruijn lookup table shared by both bit scan directions
+static const short DEBRUIJN_INDEX[BOARD_SIZE*BOARD_SIZE] = {0, 47, 1, 56, 48, 27, 2, 60,
+                                                            57, 49, 41, 37, 28, 16, 3, 61,
+                                                            54, 58, 35, 52, 50, 42, 21, 44,
+                                                            38, 32, 29, 23, 17, 11, 4, 62,
+                                                            46, 55, 26, 59, 40, 36, 15, 53,
+                                                            34, 51, 20, 43, 31, 22, 10, 45,
+                                                            25, 39, 14, 33, 19, 30, 9, 24,
+                                                            13, 18, 8, 12, 7, 6, 5, 63};
+
+// zobrist hash tables: one key per piece type and square, plus keys for the side to move, castling rights and en passant files
+static unsigned long long ZOBRIST_PIECES[13][BOARD_SIZE*BOARD_SIZE];
+static unsigned long long ZOBRIST_WHITES_TURN;
+static unsigned long long ZOBRIST_CASTLING[2];
+static unsigned long long ZOBRIST_EN_PASSANT[BOARD_SIZE];
+
+// fills the zobrist tables with a fixed-seed splitmix64 generator so the keys are reproducible across runs, returns true once done
+static bool InitZobristKeys() noexcept {
+    unsigned long long state = 0;
+    const auto &NextKey = [&state]() {
+        unsigned long long z = (state += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    };
+    for(short piece=0;piece<13;++piece)
+        for(short square=0;square<BOARD_SIZE*BOARD_SIZE;++square)
+            ZOBRIST_PIECES[piece][square] = NextKey();
+    ZOBRIST_WHITES_TURN = NextKey();
+    ZOBRIST_CASTLING[0] = NextKey(), ZOBRIST_CASTLING[1] = NextKey();
+    for(short x=0;x<BOARD_SIZE;++x)
+        ZOBRIST_EN_PASSANT[x] = NextKey();
+    return true;
+}
+static const bool ZOBRIST_KEYS_READY = InitZobristKeys();
+
+// constructor of chess class
+Chess::Chess(const std::string &player1, const unsigned short &difficulty1, const std::string &player2, const unsigned short &difficulty2) noexcept
+        : white(player1, difficulty1), black(player2, difficulty2) {
+    CopyBoard(STARTING_BOARD, board);
+    RebuildBitboards();
+    key_history.assign(1, GetZobristKey());
+}
+
+// returns the square index of the given x and y coordinates
+short Chess::ToSquare(const short &x, const short &y) noexcept {
+    return y*BOARD_SIZE + x;
+}
+
+// returns the index of the least significant set bit, "bits" must not be 0
+short Chess::BitScanForward(const Bitboard &bits) noexcept {
+    return DEBRUIJN_INDEX[((bits ^ (bits-1)) * 0x03f79d71b4cb0a89ULL) >> 58];
+}
+
+// returns the index of the most significant set bit, "bits" must not be 0
+short Chess::BitScanReverse(Bitboard bits) noexcept {
+    bits |= bits >> 1, bits |= bits >> 2, bits |= bits >> 4;
+    bits |= bits >> 8, bits |= bits >> 16, bits |= bits >> 32;
+    return DEBRUIJN_INDEX[(bits * 0x03f79d71b4cb0a89ULL) >> 58];
+}
+
+// returns the squares a sliding piece attacks along one ray, cut off at the first blocking piece
+Bitboard Chess::RayAttacks(const short &direction, const short &square, const Bitboard &occupied) noexcept {
+    Bitboard attacks = RAY_MASKS[direction][square];
+    const Bitboard &blockers = attacks & occupied;
+    if(blockers)
+        attacks ^= RAY_MASKS[direction][direction < WEST ? BitScanForward(blockers) : BitScanReverse(blockers)];
+    return attacks;
+}
+
+// returns the squares a rook attacks from the given square
+Bitboard Chess::RookAttacks(const short &square, const Bitboard &occupied) noexcept {
+    return RayAttacks(EAST, square, occupied) | RayAttacks(SOUTH, square, occupied) | RayAttacks(WEST, square, occupied) | RayAttacks(NORTH, square, occupied);
+}
+
+// returns the squares a bishop attacks from the given square
+Bitboard Chess::BishopAttacks(const short &square, const Bitboard &occupied) noexcept {
+    return RayAttacks(SOUTH_WEST, square, occupied) | RayAttacks(SOUTH_EAST, square, occupied) | RayAttacks(NORTH_EAST, square, occupied) | RayAttacks(NORTH_WEST, square, occupied);
+}
+
+// returns the squares a queen attacks from the given square
+Bitboard Chess::QueenAttacks(const short &square, const Bitboard &occupied) noexcept {
+    return RookAttacks(square, occupied) | BishopAttacks(square, occupied);
+}
+
+// puts the given piece on (x, y), keeping the bitboards, the zobrist key and the running evaluation in sync with the board, every board mutation goes through here
+void Chess::SetPiece(const short &x, const short &y, const char &piece) noexcept {
+    const Bitboard &square_mask = Bitboard(1) << ToSquare(x, y);
+    if(board[y][x] != EMPTY) {
+        piece_boards[board[y][x] + 6] &= ~square_mask;
+        color_boards[board[y][x] > 0] &= ~square_mask;
+        zobrist_key ^= ZOBRIST_PIECES[board[y][x] + 6][ToSquare(x, y)];
+        evaluation -= PieceSquareValue(board[y][x], x, y);
+    }
+    if(piece != EMPTY) {
+        piece_boards[piece + 6] |= square_mask;
+        color_boards[piece > 0] |= square_mask;
+        zobrist_key ^= ZOBRIST_PIECES[piece + 6][ToSquare(x, y)];
+        evaluation += PieceSquareValue(piece, x, y);
+    }
+    board[y][x] = piece;
+}
+
+// recomputes all bitboards, the zobrist key and the running evaluation from the board, used whenever the board changes wholesale
+void Chess::RebuildBitboards() noexcept {
+    std::fill(piece_boards, piece_boards + 13, 0);
+    color_boards[0] = color_boards[1] = 0;
+    zobrist_key = whites_turn ? ZOBRIST_WHITES_TURN : 0;
+    for(short y=0;y<BOARD_SIZE;++y)
+        for(short x=0;x<BOARD_SIZE;++x)
+            if(board[y][x] != EMPTY) {
+                piece_boards[board[y][x] + 6] |= Bitboard(1) << ToSquare(x, y);
+                color_boards[board[y][x] > 0] |= Bitboard(1) << ToSquare(x, y);
+                zobrist_key ^= ZOBRIST_PIECES[board[y][x] + 6][ToSquare(x, y)];
+            }
+    evaluation = EvaluateBoardFull();
+    move_cache_valid = false;
+}
+
+// checks whether the given coordinate is within board boundaries or not
+bool Chess::WithinBounds(const short &coord) noexcept {
+    return coord>=0 && coord<BOARD_SIZE;
+}
+
+// changes the given board coordinates from ASCII to numerical, e.g. ('d', '3') -> (3, 5)
+void Chess::ChangeToRealCoordinates(char &x1, char &y1, char &x2, char &y2) noexcept {
+    x1 -= 'a', x2 -= 'a';
+    y1 = '8'-y1, y2 = '8'-y2;
+}
+
+// changes the given board coordinates from numerical to ASCII, e.g. (3, 5) -> ('d', '3')
+void Chess::ChangeToString(char &x1, char &y1, char &x2, char &y2) noexcept {
+    x1 += 'a', x2 += 'a';
+    y1 = '8'-y1, y2 = '8'-y2;
+}
+
+// returns the given numerical board coordinates as a string
+std::string Chess::ToString(const short &x1, const short &y1, const short &x2, const short &y2) noexcept {
+    return {static_cast<char>(x1+'a'), static_cast<char>('8'-y1), static_cast<char>(x2+'a'), static_cast<char>('8'-y2)};
+}
+
+// returns the name that is displayed on the terminal for the given piece
+std::string Chess::PieceNameToString(const char &piece) noexcept {
+    switch(piece) {
+        case W_PAWN:	return "W_PAWN";
+        case B_PAWN:	return "B_PAWN";
+        case W_ROOK:	return "W_ROOK";
+        case B_ROOK:	return "B_ROOK";
+        case W_KNIGHT:	return "W_KNIGHT";
+        case B_KNIGHT:	return "B_KNIGHT";
+        case W_BISHOP:	return "W_BISHOP";
+        case B_BISHOP:	return "B_BISHOP";
+        case W_QUEEN:	return "W_QUEEN";
+        case B_QUEEN:	return "B_QUEEN";
+        case W_KING:	return "W_KING";
+        case B_KING:	return "B_KING";
+        default:		return "";
+    }
+}
+
+// returns the worth of the given piece in terms of points
+float Chess::EvaluatePiece(const char &piece) noexcept {
+    switch(piece) {
+        case W_PAWN:
+        case B_PAWN:	return 10;		// pawn: 10 points
+        case W_ROOK:
+        case B_ROOK:	return 50;		// rook: 50 points
+        case W_KNIGHT:
+        case B_KNIGHT:
+        case W_BISHOP:
+        case B_BISHOP:	return 30;		// knight and bishop: 30 points
+        case W_QUEEN:
+        case B_QUEEN:	return 90;		// queen: 90 points
+        case W_KING:
+        case B_KING:	return 900;		// king: 900 points, but you can assume it is infinite
+        default:		return 0;
+    }
+}
+
+// piece-square tables: the worth of each piece type on each square, indexed from white's point of view
+static constexpr float PIECE_POS_POINTS[6][BOARD_SIZE][BOARD_SIZE] =
+        {{{-3.0, -4.0, -4.0, -5.0, -5.0, -4.0, -4.0, -3.0},		// king
+                 {-3.0, -4.0, -4.0, -5.0, -5.0, -4.0, -4.0, -3.0},
+                 {-3.0, -4.0, -4.0, -5.0, -5.0, -4.0, -4.0, -3.0},
+                 {-3.0, -4.0, -4.0, -5.0, -5.0, -4.0, -4.0, -3.0},
+                 {-2.0, -3.0, -3.0, -4.0, -4.0, -3.0, -3.0, -2.0},
+                 {-1.0, -2.0, -2.0, -2.0, -2.0, -2.0, -2.0, -1.0},
+                 {2.0, 2.0, 0.0, 0.0, 0.0, 0.0, 2.0, 2.0},
+                 {2.0, 3.0, 1.0, 0.0, 0.0, 1.0, 3.0, 2.0}}
+                ,
+         {{-2.0, -1.0, -1.0, -0.5, -0.5, -1.0, -1.0, -2.0},		// queen
+                 {-1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0},
+                 {-1.0, 0.0, 0.5, 0.5, 0.5, 0.5, 0.0, -1.0},
+                 {-0.5, 0.0, 0.5, 0.5, 0.5, 0.5, 0.0, -0.5},
+                 {0.0, 0.0, 0.5, 0.5, 0.5, 0.5, 0.0, -0.5},
+                 {-1.0, 0.5, 0.5, 0.5, 0.5, 0.5, 0.0, -1.0},
+                 {-1.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.0, -1.0},
+                 {-2.0, -1.0, -1.0, -0.5, -0.5, -1.0, -1.0, -2.0}}
+                ,
+         {{-2.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -2.0},		// bishop
+                 {-1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0},
+                 {-1.0, 0.0, 0.5, 1.0, 1.0, 0.5, 0.0, -1.0},
+                 {-1.0, 0.5, 0.5, 1.0, 1.0, 0.5, 0.5, -1.0},
+                 {-1.0, 0.0, 1.0, 1.0, 1.0, 1.0, 0.0, -1.0},
+                 {-1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, -1.0},
+                 {-1.0, 0.5, 0.0, 0.0, 0.0, 0.0, 0.5, -1.0},
+                 {-2.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0, -2.0}}
+                ,
+         {{-5.0, -4.0, -3.0, -3.0, -3.0, -3.0, -4.0, -5.0},		// knight
+                 {-4.0, -2.0, 0.0, 0.0, 0.0, 0.0, -2.0, -4.0},
+                 {-3.0, 0.0, 1.0, 1.5, 1.5, 1.0, 0.0, -3.0},
+                 {-3.0, 0.5, 1.5, 2.0, 2.0, 1.5, 0.5, -3.0},
+                 {-3.0, 0.0, 1.5, 2.0, 2.0, 1.5, 0.0, -3.0},
+                 {-3.0, 0.5, 1.0, 1.5, 1.5, 1.0, 0.5, -3.0},
+                 {-4.0, -2.0, 0.0, 0.5, 0.5, 0.0, -2.0, -4.0},
+                 {-5.0, -4.0, -3.0, -3.0, -3.0, -3.0, -4.0, -5.0}}
+                ,
+         {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},				// rook
+                 {0.5, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 0.5},
+                 {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
+                 {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
+                 {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
+                 {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
+                 {-0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5},
+                 {0.0, 0.0, 0.0, 0.5, 0.5, 0.0, 0.0, 0.0}}
+                ,
+         {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},				// pawn
+                 {5.0, 5.0, 5.0, 5.0, 5.0, 5.0, 5.0, 5.0},
+                 {1.0, 1.0, 2.0, 3.0, 3.0, 2.0, 1.0, 1.0},
+                 {0.5, 0.5, 1.0, 2.5, 2.5, 1.0, 0.5, 0.5},
+                 {0.0, 0.0, 0.0, 2.0, 2.0, 0.0, 0.0, 0.0},
+                 {0.5, -0.5, -1.0, 0.0, 0.0, -1.0, -0.5, 0.5},
+                 {0.5, 1.0, 1.0, -2.0, -2.0, 1.0, 1.0, 0.5},
+                 {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}}};				// returns negative points if the pieces are black, positive points if the pieces are white
+
+// flat piece-square values: material and positional worth folded into one float per piece and square, generated at compile time,
+// the black entries are pre-negated and rank-flipped so scoring needs no sign test or mirroring per access
+struct EvalTables {
+    float values[13][BOARD_SIZE*BOARD_SIZE] = {};
+};
+
+// folds the material values into the piece-square tables above, one contiguous row per piece type including EMPTY
+static constexpr EvalTables InitEvalTables() noexcept {
+    EvalTables tables;
+    constexpr float MATERIAL[6] = {900.0, 90.0, 30.0, 30.0, 50.0, 10.0};	// same piece order as PIECE_POS_POINTS
+    for(short piece=1;piece<7;++piece)
+        for(short y=0;y<BOARD_SIZE;++y)
+            for(short x=0;x<BOARD_SIZE;++x) {
+                const float value = MATERIAL[piece-1] + PIECE_POS_POINTS[piece-1][y][x];
+                tables.values[piece+6][y*BOARD_SIZE + x] = value;
+                tables.values[-piece+6][(BOARD_SIZE-1-y)*BOARD_SIZE + x] = -value;
+            }
+    return tables;
+}
+static constexpr EvalTables EVAL_TABLES = InitEvalTables();
+static constexpr auto &PIECE_SQUARE_VALUES = EVAL_TABLES.values;
+
+// returns the worth of the given piece standing on (x, y) in terms of points, negative for black pieces, a single indexed load
+float Chess::PieceSquareValue(const char &piece, const short &x, const short &y) noexcept {
+    return PIECE_SQUARE_VALUES[piece + 6][y*BOARD_SIZE + x];
+}
+
+// clears all available moves from the terminal
+void Chess::ClearAllMoves(const unsigned short &n) noexcept {
+    MoveCursorToXY(0, DOWN + 3*BOARD_SIZE + 9);
+    for(unsigned short i=0;i<n;++i)
+        std::cout << CLEAR_LINE << std::endl;
+}
+
+// copies the board contents of "from" to "to"
+void Chess::CopyBoard(const char from[BOARD_SIZE][BOARD_SIZE], char to[BOARD_SIZE][BOARD_SIZE]) noexcept {
+    std::copy(*from, *from + BOARD_SIZE*BOARD_SIZE, *to);
+}
+
+bool Chess::CanMovePiece(const short &x1, const short &y1, const short &x2, const short &y2, const std::vector<Move> &all_moves) noexcept {
+    return std::find(all_moves.cbegin(), all_moves.cend(), Move(x1, y1, x2, y2)) != all_moves.cend();
+}
+
+// getter method, returns the piece located in the given x and y coordinates
+char Chess::GetPiece(const short &x, const short &y) const noexcept {
+//	CheckCoordinates(x, y, "GetPiece");
+    return board[y][x];
+}
+
+// getter method, returns whether it's team white's turn or not
+bool Chess::GetTurn() const noexcept {
+    return whites_turn;
+}
+
+// getter method, returns the game's own random stream
+RandomGenerator& Chess::GetRandomGenerator() noexcept {
+    return random_generator;
+}
+
+// getter method, returns the full zobrist key of the current position including castling rights and the en passant file
+unsigned long long Chess::GetZobristKey() const noexcept {
+    unsigned long long key = zobrist_key;
+    if(white.GetCastling())		key ^= ZOBRIST_CASTLING[1];
+    if(black.GetCastling())		key ^= ZOBRIST_CASTLING[0];
+    if(en_passant_file != -1)
+        key ^= ZOBRIST_EN_PASSANT[en_passant_file];
+    return key;
+}
+
+// returns a reference to the player object
+Bot& Chess::GetCurrentPlayer() noexcept {
+    return whites_turn ? white : black;
+}
+
+// returns a copy of the player object
+Bot Chess::GetCurrentPlayerConst() const noexcept {
+    return whites_turn ? white : black;
+}
+
+// returns a reference to the player object
+Bot& Chess::GetOtherPlayer() noexcept {
+    return whites_turn ? black : white;
+}
+
+// returns a copy of the player object
+Bot Chess::GetOtherPlayerConst() const noexcept {
+    return whites_turn ? black : white;
+}
+
+// changes whose turn it is so the other player can make its move, every make and unmake passes through here
+void Chess::ChangeTurn() noexcept {
+    whites_turn = !whites_turn;
+    zobrist_key ^= ZOBRIST_WHITES_TURN;
+    move_cache_valid = false;
+}
+
+// appends the last made game move to "all_game_moves" list
+void Chess::AppendToAllGameMoves(const short &x1, const short &y1, const short &x2, const short &y2) noexcept {
+    if(GetCurrentPlayerConst().GetCastling() && (board[y1][x1] == B_KING + 7*whites_turn) && (x2 == 2 || x2 == 6))
+        all_game_moves.emplace_back(CASTLING, std::string(1, x2));
+    else
+        all_game_moves.emplace_back(NORMAL, ToString(x1, y1, x2, y2) + board[y1][x1] + board[y2][x2]);
+}
+
+// resets the game, everything is back to its default value
+void Chess::Reset(const bool &clear_screen) noexcept {
+    CopyBoard(STARTING_BOARD, board);
+    RebuildBitboards();
+    white.Reset();
+    black.Reset();
+    all_game_moves.clear();
+    undo_history.clear();
+    whites_turn = true;
+    moves_after_last_pawn_move_or_capture = 0;
+    en_passant_file = -1;
+    random_generator.Seed(0);		// a fresh seed per game, so the seed each game record carries reproduces that game and not the whole batch
+    key_history.assign(1, GetZobristKey());
+    if(clear_screen) {
+#ifdef _WIN32
+        system("cls");
+#else
+        system("clear");
+#endif
+        renderer.Invalidate();
+    }
+}
+
+// captures the current game state into a stack-friendly snapshot
+Position Chess::SavePosition() const noexcept {
+    Position position;
+    CopyBoard(board, position.board);
+    std::copy(piece_boards, piece_boards + 13, position.piece_boards);
+    position.color_boards[0] = color_boards[0], position.color_boards[1] = color_boards[1];
+    position.zobrist_key = zobrist_key;
+    position.evaluation = evaluation;
+    position.whites_turn = whites_turn;
+    position.white_castling = white.GetCastling();
+    position.black_castling = black.GetCastling();
+    position.moves_after_last_pawn_move_or_capture = moves_after_last_pawn_move_or_capture;
+    position.en_passant_file = en_passant_file;
+    position.game_move_count = all_game_moves.size();
+    position.key_history_size = key_history.size();
+    position.undo_history_size = undo_history.size();
+    return position;
+}
+
+// restores a previously saved snapshot, only usable to roll the game state back since the move records are truncated to their saved sizes
+void Chess::RestorePosition(const Position &position) noexcept {
+    CopyBoard(position.board, board);
+    std::copy(position.piece_boards, position.piece_boards + 13, piece_boards);
+    color_boards[0] = position.color_boards[0], color_boards[1] = position.color_boards[1];
+    zobrist_key = position.zobrist_key;
+    evaluation = position.evaluation;
+    whites_turn = position.whites_turn;
+    white.SetCastling(position.white_castling);
+    black.SetCastling(position.black_castling);
+    moves_after_last_pawn_move_or_capture = position.moves_after_last_pawn_move_or_capture;
+    en_passant_file = position.en_passant_file;
+    all_game_moves.resize(position.game_move_count);
+    key_history.resize(position.key_history_size);
+    undo_history.resize(position.undo_history_size);
+    move_cache_valid = false;
+}
+
+// a function for exception handling, checks whether the given coordinates is within board boundaries or not
+void Chess::CheckCoordinates(const short &x, const short &y, const std::string &func_name) const noexcept(false) {
+    try {
+        if(!WithinBounds(x))		throw x;
+        if(!WithinBounds(y))		throw y;
+    }
+    catch(const short &coord) {
+        std::cerr << std::endl << std::endl << TO_RIGHT << "!ERROR!\t\tInvalid coordinate: '" << coord << "'.\t\t!ERROR!";
+        std::cerr << std::endl << TO_RIGHT << "      \t\tException occurred in \"" << func_name << "\".";
+        PrintAllMovesMadeInOrder();
+        exit(1);
+    }
+}
+
+// prints game over message to the terminal
+bool Chess::EndGameText(const unsigned short &n, const Endgame &end_game) const noexcept {
+    ClearAllMoves(n);
+    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 7);
+    switch(end_game) {
+        case CHECKMATE:
+            std::cout << "!!!Checkmate!!!" << CLEAR_LINE << std::endl << TO_RIGHT << GetOtherPlayerConst().GetName() << " wins!";
+            return true;
+        default:
+            std::cout << "!!!Draw!!!" << CLEAR_LINE << std::endl << TO_RIGHT;
+            switch(end_game) {
+                case FIFTY_MOVES:
+                    std::cout << "Fifty-move rule: No capture has been made and no pawn has been moved in the last 50 moves.";
+                    return true;
+                case THREEFOLD_REP:
+                    std::cout << "Threefold repetition: Last position occured 3 times during the game.";
+                    return true;
+                default:
+                    return false;
+            }
+    }
+}
+
+// returns the x coordinate of the eaten pawn piece
+short Chess::GetEnPassant(const short &x, const short &y) const noexcept {
+    return (en_passant_file != -1 && abs(en_passant_file - x) == 1 && y == 4 - whites_turn) ? en_passant_file : -1;
+}
+
+// returns true if threefold repetition occurs, false otherwise
+bool Chess::ThreefoldRepetition() const noexcept {
+    const unsigned long long &current = key_history.back();
+    unsigned short position_count = 1;
+    size_t i = key_history.size() - 1;		// index of the position each move walked over produced
+    for(auto it = all_game_moves.crbegin(); it != all_game_moves.crend() && i; ++it) {
+        if(it->first != NORMAL || it->second[4] == W_PAWN || it->second[4] == B_PAWN || it->second[5] != EMPTY)
+            return false;		// if a pawn has moved or a castling/capture has occured, then that board position is unique and repetition is not possible
+        if(key_history[--i] == current && (++position_count) == 3)
+            return true;		// the keys fold in the side to move, the castling rights and the en passant file, so equal keys mean equal positions
+    }
+    return false;
+}
+
+// returns true if the current player still owns a piece besides the king and pawns, used to avoid null-move pruning in zugzwang-prone endgames
+bool Chess::HasMajorPieces() const noexcept {
+    return piece_boards[W_QUEEN - 7*!whites_turn + 6] | piece_boards[W_ROOK - 7*!whites_turn + 6] | piece_boards[W_BISHOP - 7*!whites_turn + 6] | piece_boards[W_KNIGHT - 7*!whites_turn + 6];
+}
+
+// returns true if the player's king is in check, false otherwise
+bool Chess::IsCheck(const bool &turn) const noexcept {
+    const short &square = BitScanForward(piece_boards[B_KING + 7*turn + 6]);
+    const Bitboard &occupied = color_boards[0] | color_boards[1];
+    if(RookAttacks(square, occupied) & (piece_boards[W_ROOK - 7*turn + 6] | piece_boards[W_QUEEN - 7*turn + 6]))		// check queen and rook
+        return true;
+    if(BishopAttacks(square, occupied) & (piece_boards[W_BISHOP - 7*turn + 6] | piece_boards[W_QUEEN - 7*turn + 6]))	// check queen and bishop
+        return true;
+    if(KING_ATTACKS[square] & piece_boards[W_KING - 7*turn + 6])		// check king
+        return true;
+    if(KNIGHT_ATTACKS[square] & piece_boards[W_KNIGHT - 7*turn + 6])	// check knight
+        return true;
+    if(PAWN_ATTACKS[turn][square] & piece_boards[W_PAWN - 7*turn + 6])	// check pawn, enemy pawns attack the king from the squares a friendly pawn would attack
+        return true;
+    return false;
+}
+
+// function overload, returns true if the player's king is in check after making the given move, false otherwise
+bool Chess::IsCheck(const Move &move) noexcept {
+    MakeMove(move);
+    const bool &is_check = IsCheck(!whites_turn);
+    UnmakeMove(move);
+    return is_check;
+}
+
+// computes the squares a non-king move may target under the current checks and the movement restrictions of pinned pieces
+void Chess::ComputeLegalityMasks(Bitboard &check_mask, Bitboard &pinned, Bitboard (&pin_allowed)[BOARD_SIZE*BOARD_SIZE]) const noexcept {
+    const short &king = BitScanForward(piece_boards[B_KING + 7*whites_turn + 6]);
+    const Bitboard &occupied = color_boards[0] | color_boards[1];
+    Bitboard checkers = 0;
+    check_mask = pinned = 0;
+    for(short direction=EAST;direction<=NORTH_WEST;++direction) {		// walk every ray from the king looking for checking and pinning sliders
+        const bool &diagonal = direction == SOUTH_WEST || direction == SOUTH_EAST || direction == NORTH_EAST || direction == NORTH_WEST;
+        const Bitboard &sliders = piece_boards[W_QUEEN - 7*whites_turn + 6] | piece_boards[(diagonal ? W_BISHOP : W_ROOK) - 7*whites_turn + 6];
+        const Bitboard &ray = RayAttacks(direction, king, occupied);	// squares up to and including the first blocker
+        const Bitboard &blocker = ray & occupied;
+        if(blocker & sliders) {
+            checkers |= blocker;
+            check_mask |= ray;			// a slider check can be answered by capturing the checker or blocking the ray
+        }
+        else if(blocker & color_boards[whites_turn]) {
+            const Bitboard &behind = RayAttacks(direction, king, occupied & ~blocker);		// look past the friendly blocker for a pinning slider
+            if(behind & sliders) {
+                pinned |= blocker;
+                pin_allowed[BitScanForward(blocker)] = behind | ray;	// the pinned piece may only move along the ray, including capturing the pinner
+            }
+        }
+    }
+    check_mask |= checkers |= KNIGHT_ATTACKS[king] & piece_boards[W_KNIGHT - 7*whites_turn + 6];	// knight and pawn checks cannot be blocked,
+    check_mask |= checkers |= PAWN_ATTACKS[whites_turn][king] & piece_boards[W_PAWN - 7*whites_turn + 6];	// only the checker's square answers them
+    if(!checkers)
+        check_mask = ~Bitboard(0);			// no check, every target square is allowed
+    else if(checkers & (checkers - 1))
+        check_mask = 0;						// double check, only the king itself can move
+}
+
+// appends all possible moves the pawn located in (x, y) can make to "all_moves"
+void Chess::PawnMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept {
+    const short &inc = whites_turn ? -1 : 1;
+    const Moves &kind = (y+inc == (BOARD_SIZE-1) * !whites_turn) ? PROMOTION : NORMAL;
+    if(board[y+inc][x] == EMPTY) {
+        all_moves.emplace_back(x, y, x, y+inc, kind);				// 1 square forward
+        if((y == 1 + 5*whites_turn) && (board[y + 2*inc][x] == EMPTY))
+            all_moves.emplace_back(x, y, x, y + 2*inc);				// 2 squares forward
+    }
+    if(GetEnPassant(x, y) != -1)
+        all_moves.emplace_back(x, y, GetEnPassant(x, y), y+inc, EN_PASSANT);
+    Bitboard captures = PAWN_ATTACKS[whites_turn][ToSquare(x, y)] & color_boards[!whites_turn];
+    while(captures) {				// diagonal attack moves
+        const short &square = BitScanForward(captures);
+        all_moves.emplace_back(x, y, square%BOARD_SIZE, square/BOARD_SIZE, kind);
+        captures &= captures - 1;
+    }
+}
+
+// appends all possible moves the rook located in (x, y) can make to "all_moves"
+void Chess::RookMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept {
+    Bitboard targets = RookAttacks(ToSquare(x, y), color_boards[0] | color_boards[1]) & ~color_boards[whites_turn];
+    while(targets) {				// pop the target squares one set bit at a time
+        const short &square = BitScanForward(targets);
+        all_moves.emplace_back(x, y, square%BOARD_SIZE, square/BOARD_SIZE);
+        targets &= targets - 1;
+    }
+}
+
+// appends all possible moves the knight located in (x, y) can make to "all_moves"
+void Chess::KnightMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept {
+    Bitboard targets = KNIGHT_ATTACKS[ToSquare(x, y)] & ~color_boards[whites_turn];
+    while(targets) {				// pop the target squares one set bit at a time
+        const short &square = BitScanForward(targets);
+        all_moves.emplace_back(x, y, square%BOARD_SIZE, square/BOARD_SIZE);
+        targets &= targets - 1;
+    }
+}
+
+// appends all possible moves the bishop located in (x, y) can make to "all_moves"
+void Chess::BishopMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept {
+    Bitboard targets = BishopAttacks(ToSquare(x, y), color_boards[0] | color_boards[1]) & ~color_boards[whites_turn];
+    while(targets) {				// pop the target squares one set bit at a time
+        const short &square = BitScanForward(targets);
+        all_moves.emplace_back(x, y, square%BOARD_SIZE, square/BOARD_SIZE);
+        targets &= targets - 1;
+    }
+}
+
+// appends all possible moves the queen located in (x, y) can make to "all_moves"
+void Chess::QueenMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept {
+    RookMoves(x, y, all_moves);					// queen = rook + bishop
+    BishopMoves(x, y, all_moves);
+}
+
+// appends all possible moves the king located in (x, y) can make to "all_moves"
+void Chess::KingMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept {
+    Bitboard targets = KING_ATTACKS[ToSquare(x, y)] & ~color_boards[whites_turn];
+    while(targets) {				// add moves within 1 square reach, popping the target squares one set bit at a time
+        const short &square = BitScanForward(targets);
+        all_moves.emplace_back(x, y, square%BOARD_SIZE, square/BOARD_SIZE);
+        targets &= targets - 1;
+    }
+    if(GetCurrentPlayerConst().GetCastling())		// add castling moves if castling is possible
+        if(!IsCheck(whites_turn)) {
+            const short &line = (BOARD_SIZE-1)*whites_turn;
+            if((board[line][0] == B_ROOK + 7*whites_turn) && board[line][1] == EMPTY && board[line][2] == EMPTY && board[line][3] == EMPTY)
+                all_moves.emplace_back(4, line, 2, line, CASTLING);		// long castling
+            else if((board[line][7] == B_ROOK + 7*whites_turn) && board[line][5] == EMPTY && board[line][6] == EMPTY)
+                all_moves.emplace_back(4, line, 6, line, CASTLING);		// short castling
+        }
+}
+
+// returns a list of all possible moves the player can make
+std::vector<Move> Chess::AllMoves() noexcept {
+    if(!move_cache_valid) {
+        move_cache.reserve(64);
+        AllMoves(move_cache);
+        move_cache_valid = true;
+    }
+    return move_cache;		// returned by value, the cache stays warm for the next caller on the same position
+}
+
+// fills "all_moves" with all possible moves the player can make, reusing the vector's existing storage
+void Chess::AllMoves(std::vector<Move> &all_moves) noexcept {
+    PseudoLegalMoves(all_moves);
+    Bitboard check_mask, pinned, pin_allowed[BOARD_SIZE*BOARD_SIZE];	// only the entries of pinned squares are ever written or read
+    ComputeLegalityMasks(check_mask, pinned, pin_allowed);
+    all_moves.erase(std::remove_if(all_moves.begin(), all_moves.end(), [&, this](const Move &move) {	// remove the moves that leave my own king in check
+        const char &piece = board[move.FromY()][move.FromX()];
+        if((piece == W_KING - 7*!whites_turn) || move.Kind() == EN_PASSANT || move.Kind() == CASTLING)
+            return IsCheck(move);			// the masks cannot judge these, fall back to the make/unmake round trip
+        const Bitboard &from_mask = Bitboard(1) << ToSquare(move.FromX(), move.FromY());
+        const Bitboard &to_mask = Bitboard(1) << ToSquare(move.ToX(), move.ToY());
+        return !(to_mask & check_mask & (pinned & from_mask ? pin_allowed[ToSquare(move.FromX(), move.FromY())] : ~Bitboard(0)));
+    }), all_moves.end());
+}
+
+// fills "all_moves" with every pseudo-legal move of the current player, whether the king is left in check is not tested
+void Chess::PseudoLegalMoves(std::vector<Move> &all_moves) noexcept {
+    all_moves.clear();
+    for(short y=0;y<BOARD_SIZE;++y)
+        for(short x=0;x<BOARD_SIZE;++x) {
+            if((board[y][x] < 0) == whites_turn)
+                continue;
+            switch(board[y][x]) {
+                case W_PAWN:
+                case B_PAWN:
+                    PawnMoves(x, y, all_moves);
+                    break;
+                case W_ROOK:
+                case B_ROOK:
+                    RookMoves(x, y, all_moves);
+                    break;
+                case W_KNIGHT:
+                case B_KNIGHT:
+                    KnightMoves(x, y, all_moves);
+                    break;
+                case W_BISHOP:
+                case B_BISHOP:
+                    BishopMoves(x, y, all_moves);
+                    break;
+                case W_QUEEN:
+                case B_QUEEN:
+                    QueenMoves(x, y, all_moves);
+                    break;
+                case W_KING:
+                case B_KING:
+                    KingMoves(x, y, all_moves);
+            }
+        }
+}
+
+// returns true as soon as one legal move exists, cheaper than materializing the whole list just to see that it is not empty
+bool Chess::HasLegalMove() noexcept {
+    if(move_cache_valid)
+        return !move_cache.empty();
+    Bitboard check_mask, pinned, pin_allowed[BOARD_SIZE*BOARD_SIZE];	// only the entries of pinned squares are ever written or read
+    ComputeLegalityMasks(check_mask, pinned, pin_allowed);
+    const auto &IsLegal = [&, this](const Move &move) {
+        const char &piece = board[move.FromY()][move.FromX()];
+        if((piece == W_KING - 7*!whites_turn) || move.Kind() == EN_PASSANT || move.Kind() == CASTLING)
+            return !IsCheck(move);			// the masks cannot judge these, fall back to the make/unmake round trip
+        const Bitboard &from_mask = Bitboard(1) << ToSquare(move.FromX(), move.FromY());
+        const Bitboard &to_mask = Bitboard(1) << ToSquare(move.ToX(), move.ToY());
+        return bool(to_mask & check_mask & (pinned & from_mask ? pin_allowed[ToSquare(move.FromX(), move.FromY())] : ~Bitboard(0)));
+    };
+    static thread_local std::vector<Move> candidate_moves;		// probe scratch space, reused between calls
+    const short &king = BitScanForward(piece_boards[W_KING - 7*!whites_turn + 6]);
+    candidate_moves.clear();
+    KingMoves(king % BOARD_SIZE, king / BOARD_SIZE, candidate_moves);		// king moves double as check evasions, try them first
+    for(const auto &move : candidate_moves)
+        if(IsLegal(move))
+            return true;
+    PseudoLegalMoves(candidate_moves);
+    for(const auto &move : candidate_moves)
+        if(IsLegal(move))
+            return true;
+    return false;
+}
+
+// returns a random move the player can make
+Move Chess::GetRandomMove() noexcept {
+    const auto &all_moves = AllMoves();
+    return all_moves[random_generator.Below(all_moves.size())];
+}
+
+// asks the player it's choice of promotion and returns the desired piece
+char Chess::ManuallyPromotePawn() const noexcept {
+    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 7);
+    std::cout << "Enter your choice of promotion [(r)ook, (k)night, (b)ishop, (q)ueen]";
+    char key = getch();
+    while(true)
+        switch(key = tolower(key)) {
+            case 'r':	return whites_turn ? W_ROOK : B_ROOK;
+            case 'k':	return whites_turn ? W_KNIGHT : B_KNIGHT;
+            case 'b':	return whites_turn ? W_BISHOP : B_BISHOP;
+            case 'q':	return whites_turn ? W_QUEEN : B_QUEEN;
+            default:	key = getch();
+        }
+}
+
+// moves the piece from (x1, y1) to (x2, y2) as a real game move, recording it in the game history and updating the display
+void Chess::MovePiece(const short &x1, const short &y1, const short &x2, const short &y2, const bool &manual_promotion, const bool &update_board) noexcept {
+//	CheckCoordinates(x1, y1, "MovePiece");
+//	CheckCoordinates(x2, y2, "MovePiece");
+    AppendToAllGameMoves(x1, y1, x2, y2);		// similar to FEN notation but not really, the starting and ending points of the moving piece, promoted piece if there is promotion and ability to do castling
+    const bool &promoting = (board[y1][x1] == B_PAWN + 7*whites_turn) && (y2 == (BOARD_SIZE-1) * !whites_turn);
+    char promotion = EMPTY;
+    if(manual_promotion && promoting) {
+        promotion = ManuallyPromotePawn();
+        MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 7);
+        std::cout << "All possible moves:" << CLEAR_LINE;
+    }
+    MakeMove(Move(x1, y1, x2, y2), promotion);
+    const UndoState &undo = undo_history.back();
+    auto &record = all_game_moves.back();
+    if(record.first != CASTLING) {
+        if(promoting) {
+            record.first = PROMOTION;
+            record.second.push_back(board[y2][x2]);
+        }
+        else if(undo.kind == EN_PASSANT)
+            record.first = EN_PASSANT;
+        record.second.push_back(GetOtherPlayerConst().GetCastling());		// the mover's flag after the move, the turn already changed
+    }
+    if(update_board) {
+        if(undo.kind == EN_PASSANT) {
+            GetOtherPlayer().IncreaseScore(EvaluatePiece(W_PAWN));
+            UpdateScore(GetOtherPlayerConst());
+            UpdateBoard(x2, y1);
+        }
+        else if(undo.captured != EMPTY) {
+            GetOtherPlayer().IncreaseScore(EvaluatePiece(undo.captured));
+            UpdateScore(GetOtherPlayerConst());
+            moves_after_last_pawn_move_or_capture = 0;		// the piece is eaten
+        }
+        else if(undo.kind == CASTLING) {
+            const short &line = (BOARD_SIZE-1) * !whites_turn;		// the mover's back rank, the turn already changed
+            UpdateBoard(x2 == 2 ? 0 : 7, line);
+            UpdateBoard(x2 == 2 ? 3 : 5, line);
+        }
+        UpdateBoard(x1, y1);
+        UpdateBoard(x2, y2);
+        renderer.Present();		// one console write per move, however many cells changed
+    }
+}
+
+// function overload, moves the piece the given move describes
+void Chess::MovePiece(const Move &move, const bool &manual_promotion, const bool &update_board) noexcept {
+    MovePiece(move.FromX(), move.FromY(), move.ToX(), move.ToY(), manual_promotion, update_board);
+}
+
+// makes the given move on the board, pushing everything it destroys onto the undo stack, the string game history is not touched
+void Chess::MakeMove(const Move &move, const char &promotion) noexcept {
+    const short &x1 = move.FromX(), &y1 = move.FromY(), &x2 = move.ToX(), &y2 = move.ToY();
+    UndoState undo;
+    undo.kind = NORMAL;
+    undo.moved = board[y1][x1];
+    undo.captured = board[y2][x2];
+    undo.castling_right = GetCurrentPlayerConst().GetCastling();
+    undo.en_passant_file = en_passant_file;
+    if(undo.castling_right && (board[y1][x1] == B_KING + 7*whites_turn) && (x2 == 2 || x2 == 6))
+        undo.kind = CASTLING;
+    en_passant_file = -1;
+    switch(board[y1][x1]) {
+        case W_PAWN:
+        case B_PAWN:
+            if(y2 == ((BOARD_SIZE-1) * !whites_turn)) {			// promotion, the caller may have chosen the piece already
+                if(promotion != EMPTY)
+                    SetPiece(x1, y1, promotion);
+                else if(whites_turn ? WHITE_BOT_RANDOM : BLACK_BOT_RANDOM)
+                    SetPiece(x1, y1, (whites_turn ? 1 : -1) * static_cast<char>(W_QUEEN + random_generator.Below(4)));
+                else
+                    SetPiece(x1, y1, whites_turn ? W_QUEEN : B_QUEEN);
+                undo.kind = PROMOTION;
+            }
+            else if(x1 != x2 && board[y2][x2] == EMPTY) {
+                SetPiece(x2, y1, EMPTY);						// en passant, the captured pawn stands beside the target square
+                undo.kind = EN_PASSANT;
+            }
+            else if(abs(y2 - y1) == 2)
+                en_passant_file = x1;							// a double push, the opponent may answer en passant
+            break;
+        case W_KING:
+        case B_KING:
+            if(undo.kind == CASTLING) {
+                const short &line = (BOARD_SIZE-1) * whites_turn;
+                switch(x2) {
+                    case 2:	SetPiece(3, line, board[line][0]), SetPiece(0, line, EMPTY);	break;
+                    case 6:	SetPiece(5, line, board[line][7]), SetPiece(7, line, EMPTY);
+                }
+            }
+            [[fallthrough]];		// a king move loses the castling right just like a rook move
+        case W_ROOK:
+        case B_ROOK:
+            GetCurrentPlayer().SetCastling(false);
+    }
+    SetPiece(x2, y2, board[y1][x1]), SetPiece(x1, y1, EMPTY);
+    undo_history.push_back(undo);
+    ChangeTurn();		// it's the opponent's turn
+    key_history.push_back(GetZobristKey());
+}
+
+// takes the given move back using the undo stack, the exact opposite of the "MakeMove" function
+void Chess::UnmakeMove(const Move &move) noexcept {
+    const UndoState &undo = undo_history.back();
+    key_history.pop_back();
+    ChangeTurn();
+    const short &x1 = move.FromX(), &y1 = move.FromY(), &x2 = move.ToX(), &y2 = move.ToY();
+    SetPiece(x1, y1, undo.kind == PROMOTION ? static_cast<char>(B_PAWN + 7*whites_turn) : board[y2][x2]);
+    SetPiece(x2, y2, undo.captured);
+    if(undo.kind == EN_PASSANT)
+        SetPiece(x2, y1, whites_turn ? B_PAWN : W_PAWN);
+    else if(undo.kind == CASTLING) {
+        const short &line = (BOARD_SIZE-1) * whites_turn;
+        switch(x2) {
+            case 2:	SetPiece(0, line, board[line][3]), SetPiece(3, line, EMPTY);	break;
+            case 6:	SetPiece(7, line, board[line][5]), SetPiece(5, line, EMPTY);
+        }
+    }
+    GetCurrentPlayer().SetCastling(undo.castling_right);
+    en_passant_file = undo.en_passant_file;
+    undo_history.pop_back();
+}
+
+// gives the turn to the opponent without moving a piece, used by the search's null-move pruning
+void Chess::MakeNullMove() noexcept {
+    UndoState undo;
+    undo.kind = NORMAL;
+    undo.moved = undo.captured = EMPTY;
+    undo.castling_right = GetCurrentPlayerConst().GetCastling();
+    undo.en_passant_file = en_passant_file;
+    en_passant_file = -1;		// the right to capture en passant lapses with the passed turn
+    undo_history.push_back(undo);
+    ChangeTurn();
+    key_history.push_back(GetZobristKey());
+}
+
+// takes the passed turn back, the opposite of the "MakeNullMove" function
+void Chess::UnmakeNullMove() noexcept {
+    key_history.pop_back();
+    ChangeTurn();
+    en_passant_file = undo_history.back().en_passant_file;
+    undo_history.pop_back();
+}
+
+// updates the board display on the terminal
+void Chess::UpdateBoard(const short &x, const short &y) const noexcept {
+    const unsigned short &diff = BOX_WIDTH - PieceNameToString(board[y][x]).length();
+    renderer.Write(RIGHT + (BOX_WIDTH+1)*x, DOWN + 3*y + 1, std::string(diff/2, ' ') + PieceNameToString(board[y][x]) + std::string(diff/2 + diff%2, ' '));
+}
+
+// updates the score display on the terminal
+void Chess::UpdateScore(const Bot &p) const noexcept {
+    const unsigned short &dx = p==white ? white.GetName().length() + 2 : (BOX_WIDTH+1)*BOARD_SIZE - 5;
+    renderer.Write(RIGHT+dx, DOWN + 3*BOARD_SIZE + 2, std::to_string(p.GetScore()) + "  ");
+}
+
+// returns the worth of the position of the piece in terms of points
+float Chess::EvaluatePosition(const short &x, const short &y) const noexcept {
+    return PieceSquareValue(board[y][x], x, y);
+}
+
+// returns the worth of the board position in terms of points, a constant-time read of the incrementally maintained score
+float Chess::EvaluateBoard(const bool &turn) const noexcept {
+    return (turn ? 1 : -1) * evaluation;
+}
+
+// recomputes the board score from scratch as one flat branchless sum the compiler can vectorize, verifies the incremental score
+float Chess::EvaluateBoardFull() const noexcept {
+    float points = 0;
+    const char *squares = &board[0][0];
+    for(short square=0;square<BOARD_SIZE*BOARD_SIZE;++square)
+        points += PIECE_SQUARE_VALUES[squares[square] + 6][square];
+    return points;
+}
+
+// composes the game board into the frame buffer and flushes it, the interactive text below the board stays on std::cout
+void Chess::PrintBoard() const noexcept {
+    renderer.Clear();
+    std::string bars, underscores;
+    for(short i=0;i<BOARD_SIZE;++i) {
+        bars += std::string(BOX_WIDTH, ' ') + (i < BOARD_SIZE-1 ? "|" : "");
+        underscores += std::string(BOX_WIDTH, '_') + (i < BOARD_SIZE-1 ? "|" : "");
+    }
+    for(short y=0;y<BOARD_SIZE;++y) {
+        renderer.Write(RIGHT, DOWN + 3*y, bars);
+        renderer.Write(RIGHT-3, DOWN + 3*y + 1, std::to_string(BOARD_SIZE-y));
+        renderer.Write(RIGHT, DOWN + 3*y + 1, bars);
+        for(short x=0;x<BOARD_SIZE;++x)
+            UpdateBoard(x, y);
+        if(y < BOARD_SIZE-1)
+            renderer.Write(RIGHT, DOWN + 3*y + 2, underscores);
+    }
+    renderer.Write(RIGHT, DOWN + 3*BOARD_SIZE - 1, bars);
+    for(char ch='a';ch<'a'+BOARD_SIZE;++ch)
+        renderer.Write(RIGHT + (BOX_WIDTH+1)*(ch-'a') + BOX_WIDTH/2, DOWN + 3*BOARD_SIZE, std::string(1, ch));
+    renderer.Write(RIGHT, DOWN + 3*BOARD_SIZE + 2, white.GetName() + ": " + std::to_string(white.GetScore()));
+    renderer.Write(RIGHT + (BOX_WIDTH+1)*BOARD_SIZE - black.GetName().length() - 7, DOWN + 3*BOARD_SIZE + 2, black.GetName() + ": " + std::to_string(black.GetScore()));	// the score lands where "UpdateScore" expects it
+    renderer.Present();
+    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 4);
+    std::cout << white.GetName() << "'s turn...";
+    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 5);
+    std::cout << "Enter move coordinates (x1,y1)->(x2,y2):";
+    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 7);
+    std::cout << "All possible moves:";
+    MoveCursorToXY(0, DOWN + 3*BOARD_SIZE + 8);
+}
+
+// after the game is over, prints all moves played throughout the game in chronological order
+void Chess::PrintAllMovesMadeInOrder() const noexcept {
+    std::cout << std::endl << std::endl << TO_RIGHT << "All moves made in order:" << std::endl;
+    bool turn = true;
+    for(const auto &game_move : all_game_moves) {
+        std::cout << std::endl << TO_RIGHT << (turn ? white : black).GetName() << ": ";
+        switch(game_move.first) {
+            case CASTLING:
+                std::cout << "castling " << (game_move.second[0] == 2 ? "long" : "short");	break;
+            default:
+                std::cout << ToLowerString(PieceNameToString(game_move.second[4])).substr(2) << " '" << game_move.second.substr(0, 2) << "' to ";
+                if(game_move.second[5] != EMPTY)
+                    std::cout << ToLowerString(PieceNameToString(game_move.second[5])).substr(2) + " ";
+                std::cout << "'" << game_move.second.substr(2, 2) << "'";
+                switch(game_move.first) {
+                    case PROMOTION:
+                        std::cout << " promoted to " << ToLowerString(PieceNameToString(game_move.second[6])).substr(2);
+                        break;
+                    case EN_PASSANT:
+                        std::cout << " (en passant)";
+                    default:
+                        break;
+                }
+        }
+        turn = !turn;
+    }
+}
+
+// checks whether the game has ended without touching the console, keeps the fifty-move counter up to date
+Endgame Chess::DetectEndgame() noexcept {
+    if(!HasLegalMove())					// if the opponent has no moves left, then it is checkmate
+        return CHECKMATE;
+    if(all_game_moves.back().first != CASTLING) {
+        if(all_game_moves.back().second[4] == W_PAWN - 7*whites_turn)
+            moves_after_last_pawn_move_or_capture = 0;		// pawn has moved
+        else if(all_game_moves.back().second[5] != EMPTY)
+            moves_after_last_pawn_move_or_capture = 0;		// capture has occured
+        else if((++moves_after_last_pawn_move_or_capture) == 50)
+            return FIFTY_MOVES;
+    }
+    else if((++moves_after_last_pawn_move_or_capture) == 50)
+        return FIFTY_MOVES;
+    return ThreefoldRepetition() ? THREEFOLD_REP : ONGOING;
+}
+
+// checks if the game is over or not and prints the result to the terminal
+bool Chess::CheckEndgame(const unsigned short &n) noexcept {
+    const Endgame &end_game = DetectEndgame();
+    if(end_game == CHECKMATE) {
+        GetOtherPlayer().IncreaseScore(EvaluatePiece(W_KING));
+        UpdateScore(GetOtherPlayerConst());
+        renderer.Present();
+    }
+    if(RECORD_GAMES && end_game != ONGOING) {
+        SaveGameRecord(end_game);
+        SavePGN(end_game);
+    }
+    return end_game != ONGOING && EndGameText(n, end_game);
+}
+
+// lists all possible moves, expects player input and plays the given move if it is valid, expects a valid input otherwise
+bool Chess::PlayersTurn() noexcept {
+    const auto &all_moves = AllMoves();
+    std::vector<std::string> move_texts;		// the packed moves are only turned into strings here, at the UI boundary
+    move_texts.reserve(all_moves.size());
+    for(const auto &move : all_moves)
+        move_texts.emplace_back(move.ToText());
+    sort(move_texts.begin(), move_texts.end());
+    unsigned short i=0;
+    for(const auto &move : move_texts) {
+        if(!((i++)%MOVES_PER_LINE))	std::cout << std::endl;
+        std::cout << TO_RIGHT << move.substr(0, 2) << " " << move.substr(2);
+    }
+    if(IsCheck(whites_turn)) {
+        std::cout << std::endl << std::endl << TO_RIGHT << "Check!";
+        i += 2*MOVES_PER_LINE;
+    }
+    MoveCursorToXY(RIGHT+41, DOWN + 3*BOARD_SIZE + 5);
+    while(true) {
+        std::string from, to;
+        std::cin >> from;
+        if(!ToLowerString(from).compare("quit"))
+            return EndGameText(i/MOVES_PER_LINE + 1, QUIT);
+        if(!ToLowerString(from).compare("exit"))
+            return EndGameText(i/MOVES_PER_LINE + 1, QUIT);
+        std::cin >> to;
+        from.resize(2);
+        to.resize(2);
+        from.shrink_to_fit();
+        to.shrink_to_fit();
+        from[0] = tolower(from[0]), to[0] = tolower(to[0]);
+        ChangeToRealCoordinates(from[0], from[1], to[0], to[1]);
+        if((from[0]!=to[0] || from[1]!=to[1]) && WithinBounds(from[0]) && WithinBounds(from[1]) && WithinBounds(to[0]) && WithinBounds(to[1]))
+            if(CanMovePiece(from[0], from[1], to[0], to[1], all_moves)) {
+                MovePiece(from[0], from[1], to[0], to[1], true, true);
+                if(CheckEndgame(i/MOVES_PER_LINE + 1))
+                    return false;
+                break;
+            }
+        MoveCursorToXY(RIGHT+41, DOWN + 3*BOARD_SIZE + 5);
+        std::cout << CLEAR_LINE << std::endl << CLEAR_LINE;
+        MoveCursorToXY(RIGHT+41, DOWN + 3*BOARD_SIZE + 5);
+    }
+    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 4);
+    std::cout << GetCurrentPlayerConst().GetName() << "'s turn..." << CLEAR_LINE;
+    MoveCursorToXY(RIGHT+41, DOWN + 3*BOARD_SIZE + 5);
+    std::cout << CLEAR_LINE << std::endl << CLEAR_LINE;
+    ClearAllMoves(i/MOVES_PER_LINE + 1);
+    MoveCursorToXY(0, DOWN + 3*BOARD_SIZE + 8);
+    return true;
+}
+
+// plays the bots move
+bool Chess::BotsTurn() noexcept {
+    const auto &move = (whites_turn ? WHITE_BOT_RANDOM : BLACK_BOT_RANDOM) ? GetRandomMove() : GetCurrentPlayer().GetIdealMove(*this);
+    MovePiece(move, false, true);
+    if(CheckEndgame())
+        return false;
+    if(PONDERING && AGAINST_BOT && !TWO_BOTS)
+        PathNode::StartPondering(*this);		// keep searching the opponent's position while the human thinks
+    MoveCursorToXY(RIGHT, DOWN + 3*BOARD_SIZE + 4);
+    std::cout << GetCurrentPlayerConst().GetName() << "'s turn..." << CLEAR_LINE;
+    return true;
+}
+
+// prints game over messages and expects user input for another game
+bool Chess::GameOver() noexcept {
+    PathNode::StopPondering();		// the ponder worker must not keep running into the next game or past program exit
+    std::cout << std::endl << std::endl << std::endl << TO_RIGHT << "Press R to play again.";
+    std::cout << std::endl << TO_RIGHT << "Press any other key to quit.";
+    PrintAllMovesMadeInOrder();
+    char key = getch();
+    switch(key = tolower(key)) {
+        case 'r':
+            Reset();
+            return true;
+        default:
+            return false;
+    }
 }
\ No newline at end of file
@@ -1,162 +1,383 @@
-#ifndef CHESSBOT_CHESS_H
-#define CHESSBOT_CHESS_H
-
-#define BOARD_SIZE 8
-#define BOX_WIDTH 10
-#define DOWN 3
-#define RIGHT 10
-#define TO_DOWN std::string(DOWN, '\n')
-#define TO_RIGHT std::string(RIGHT, ' ')
-#define CLEAR_LINE std::string(100, ' ')
-#define MOVES_PER_LINE 5
-
-#define AGAINST_BOT true			// if true then it's ? vs bot, if false then it's player vs player
-#define TWO_BOTS true				// assuming AGAINST_BOT is true, if true then it's bot vs bot, if false then it's player vs bot
-#define BOT_IS_WHITE false			// assuming AGAINST_BOT is true and TWO_BOTS is false, if true then the bot is team white, black otherwise
-#define WHITE_BOT_RANDOM true		// if true the white bot returns random moves, if false the white bot returns smart moves generated by minimax algorithm
-#define BLACK_BOT_RANDOM false		// if true the black bot returns random moves, if false the black bot returns smart moves generated by minimax algorithm
-#define WHITE_BOT_DIFFICULTY 3		// the tree depth of decision tree of the bot, which is also correlated to the bot's difficulty (aka chess IQ)
-#define BLACK_BOT_DIFFICULTY 3		// 1: easy, 2: medium, 3: hard
-
-// types of chess pieces
-typedef enum {
-    B_KING = -6, B_QUEEN, B_BISHOP, B_KNIGHT, B_ROOK, B_PAWN, EMPTY,
-    W_KING, W_QUEEN, W_BISHOP, W_KNIGHT, W_ROOK, W_PAWN
-} ChessPieces;
-
-// types of player moves
-typedef enum {
-    NORMAL, CASTLING, PROMOTION, EN_PASSANT
-} Moves;
-
-// possible options on how the game can end
-typedef enum {
-    CHECKMATE, FIFTY_MOVES, THREEFOLD_REP, QUIT
-} Endgame;
-
-// starting position of the board
-const char STARTING_BOARD[BOARD_SIZE][BOARD_SIZE] = {{B_ROOK, B_KNIGHT, B_BISHOP, B_QUEEN, B_KING, B_BISHOP, B_KNIGHT, B_ROOK},
-                                                     {B_PAWN, B_PAWN, B_PAWN, B_PAWN, B_PAWN, B_PAWN, B_PAWN, B_PAWN},
-                                                     {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY},
-                                                     {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY},
-                                                     {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY},
-                                                     {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY},
-                                                     {W_PAWN, W_PAWN, W_PAWN, W_PAWN, W_PAWN, W_PAWN, W_PAWN, W_PAWN},
-                                                     {W_ROOK, W_KNIGHT, W_BISHOP, W_QUEEN, W_KING, W_BISHOP, W_KNIGHT, W_ROOK}};
-
-class Player;
-class PathNode;
-class Bot;
-class Chess;
-
-#include <string>
-#include <forward_list>
-#include <vector>
-#include <map>
-
-// player class declaration
-class Player {
-protected:
-    std::string name;			// name of the player
-    unsigned short score = 0;	// score of the player
-    bool castling = true;		// if true the player can castle, if false the player cannot castle anymore during the game
-public:
-    Player(const std::string &name) noexcept;
-    std::string GetName() const noexcept;
-    unsigned short GetScore() const noexcept;
-    bool GetCastling() const noexcept;
-    void SetCastling(const bool &castling) noexcept;
-    void IncreaseScore(const unsigned short &inc) noexcept;
-    void Reset() noexcept;
-    bool operator== (const Player &p) const noexcept;
-};
-
-// path node class declaration
-class PathNode {
-private:
-    std::map<std::string, PathNode> child_node_list;	// a map where the key (string) corresponds to the player's move and value corresponds to another node, which makes a decision tree
-    void CreateSubtree(Chess &c) noexcept;
-    float AlphaBeta(Chess &c, unsigned short &depth, float alpha, float beta, const bool &maximizing_player, const bool &initial_turn) noexcept;
-public:
-    std::string AlphaBetaRoot(Chess &c, unsigned short &difficulty) noexcept;
-};
-
-// bot class declaration, which inherits from player class
-class Bot : public Player {
-private:
-    PathNode root;					// the root node of the bot's decision tree
-    unsigned short difficulty;		// the depth of the bot's decision tree
-public:
-    Bot(const std::string &name, const unsigned short &difficulty) noexcept;
-    unsigned short GetDifficulty() const noexcept;
-    std::string GetIdealMove(Chess &c) noexcept;
-    std::string GetIdealMove(Chess &c, unsigned short difficulty) noexcept;
-    bool operator== (const Bot &b) const noexcept;
-};
-
-// chess class declaration
-class Chess {
-private:
-    char board[BOARD_SIZE][BOARD_SIZE];		// game board
-    Bot white, black;						// teams
-    std::vector<std::pair<Moves, std::string>> all_game_moves;		// a record which contains all the moves played throughout the game in chronological order
-    bool whites_turn = true;				// if true then it's team white's turn, if false then it's team black's turn
-    unsigned short moves_after_last_pawn_move_or_capture = 0;		// number of moves played after a pawn moved or a capture happened
-    static bool WithinBounds(const short &coord) noexcept;
-    static void ChangeToString(char &x1, char &y1, char &x2, char &y2) noexcept;
-    static std::string ToString(const short &x1, const short &y1, const short &x2, const short &y2) noexcept;
-    static std::string PieceNameToString(const char &piece) noexcept;
-    static float EvaluatePiece(const char &piece) noexcept;
-    static void ClearAllMoves(const unsigned short &n) noexcept;
-    static void PrintSeparator(const char &ch) noexcept;
-    static void CopyBoard(const char from[BOARD_SIZE][BOARD_SIZE], char to[BOARD_SIZE][BOARD_SIZE]) noexcept;
-    static bool AreBoardsEqual(const char board1[BOARD_SIZE][BOARD_SIZE], const char board2[BOARD_SIZE][BOARD_SIZE]) noexcept;
-    static bool CanMovePiece(const short &x1, const short &y1, const short &x2, const short &y2, const std::forward_list<std::string> &all_moves) noexcept;
-    Bot& GetCurrentPlayer() noexcept;
-    Bot GetCurrentPlayerConst() const noexcept;
-    Bot& GetOtherPlayer() noexcept;
-    Bot GetOtherPlayerConst() const noexcept;
-    void ChangeTurn() noexcept;
-    void AppendToAllGameMoves(const short &x1, const short &y1, const short &x2, const short &y2) noexcept;
-    void Reset() noexcept;
-    void CheckCoordinates(const short &x, const short &y, const std::string &func_name) const noexcept(false);
-    bool EndGameText(const unsigned short &n, const Endgame &end_game) const noexcept;
-    short GetEnPassant(const short &x, const short &y) const noexcept;
-    template<class Iterator> short GetEnPassant(const char board[BOARD_SIZE][BOARD_SIZE], const Iterator &it) const noexcept;
-    bool ThreefoldRepetition() const noexcept;
-    bool IsCheck(const bool &turn) const noexcept;
-    bool IsCheck(std::string &move) noexcept;
-    std::forward_list<std::string> PawnMoves(const short &x, const short &y) const noexcept;
-    std::forward_list<std::string> RookMoves(const short &x, const short &y) const noexcept;
-    std::forward_list<std::string> KnightMoves(const short &x, const short &y) const noexcept;
-    std::forward_list<std::string> BishopMoves(const short &x, const short &y) const noexcept;
-    std::forward_list<std::string> QueenMoves(const short &x, const short &y) const noexcept;
-    std::forward_list<std::string> KingMoves(const short &x, const short &y) const noexcept;
-    std::string GetRandomMove() noexcept;
-    void ManuallyPromotePawn(const short &x, const short &y) noexcept;
-    void UpdateBoard(const short &x, const short &y) const noexcept;
-    void UpdateScore(const Bot &p) const noexcept;
-    float EvaluatePosition(const short &x, const short &y) const noexcept;
-    void PrintAllMovesMadeInOrder() const noexcept;
-    bool CheckEndgame(const unsigned short &n = 0) noexcept;
-public:
-    Chess(const std::string &player1, const unsigned short &difficulty1, const std::string &player2, const unsigned short &difficulty2) noexcept;
-    static void ChangeToRealCoordinates(char &x1, char &y1, char &x2, char &y2) noexcept;
-    char GetPiece(const short &x, const short &y) const noexcept;
-    bool GetTurn() const noexcept;
-    std::forward_list<std::string> AllMoves() noexcept;
-    void MovePiece(const short &x1, const short &y1, const short &x2, const short &y2, const bool &manual_promotion, const bool &update_board) noexcept;
-    void MovePieceBack(const short &x1, const short &y1, const short &x2, const short &y2) noexcept;
-    float EvaluateBoard(const bool &turn) const noexcept;
-    void PrintBoard() const noexcept;
-    bool PlayersTurn() noexcept;
-    bool BotsTurn() noexcept;
-    bool GameOver() noexcept;
-};
-
-// other function declarations
-void MoveCursorToXY(const short &x, const short &y) noexcept;
-std::string ToLowerString(std::string s) noexcept;
-template<class T> T GetRandomNumber(const T &min, const T &max) noexcept;
-
-#endif //CHESSBOT_CHESS_H
+#ifndef CHESSBOT_CHESS_H
+#define CHESSBOT_CHESS_H
+
+#define BOARD_SIZE 8
+#define BOX_WIDTH 10
+#define DOWN 3
+#define RIGHT 10
+#define TO_DOWN std::string(DOWN, '\n')
+#define TO_RIGHT std::string(RIGHT, ' ')
+#define CLEAR_LINE std::string(100, ' ')
+#define MOVES_PER_LINE 5
+#define FRAME_WIDTH (RIGHT + (BOX_WIDTH+1)*BOARD_SIZE)		// width of the renderer's frame buffer in console cells
+#define FRAME_HEIGHT (DOWN + 3*BOARD_SIZE + 3)				// the renderer owns the board and score rows, the text below stays on std::cout
+
+#define AGAINST_BOT true			// if true then it's ? vs bot, if false then it's player vs player
+#define TWO_BOTS true				// assuming AGAINST_BOT is true, if true then it's bot vs bot, if false then it's player vs bot
+#define BOT_IS_WHITE false			// assuming AGAINST_BOT is true and TWO_BOTS is false, if true then the bot is team white, black otherwise
+#define WHITE_BOT_RANDOM true		// if true the white bot returns random moves, if false the white bot returns smart moves generated by minimax algorithm
+#define BLACK_BOT_RANDOM false		// if true the black bot returns random moves, if false the black bot returns smart moves generated by minimax algorithm
+#define WHITE_BOT_DIFFICULTY 3		// the tree depth of decision tree of the bot, which is also correlated to the bot's difficulty (aka chess IQ)
+#define BLACK_BOT_DIFFICULTY 3		// 1: easy, 2: medium, 3: hard
+#define TT_SIZE_MB 64				// size of the transposition table in megabytes, its entry count is rounded down to a power of two
+#define PARALLEL_SEARCH true		// if true "AlphaBetaRoot" distributes the root moves across a pool of worker threads, if false it searches them one by one
+#define SEARCH_THREADS 4			// number of worker threads used by the root search when PARALLEL_SEARCH is enabled
+#define MOVE_TIME_MS 1000			// per-move time budget in milliseconds for the iterative deepening search, 0 keeps the fixed-depth difficulty search instead
+#define MAX_SEARCH_DEPTH 32			// upper bound on the depth the iterative deepening driver will try within its time budget
+#define PONDERING true				// if true the bot keeps searching on the opponent's time in player vs bot games, warming the shared transposition table
+#define HEADLESS_MODE false			// if true the program plays HEADLESS_GAMES bot vs bot games without the console renderer and prints one summary at the end
+#define HEADLESS_GAMES 100			// number of back to back games the headless runner plays
+#define PERFT_MODE false			// if true the program counts leaf nodes of the legal move tree instead of playing, validating and benchmarking move generation
+#define PERFT_DEPTH 5				// number of plies the perft run walks from the starting position
+#define RECORD_GAMES false			// if true every finished game is appended to the binary archive and the PGN file below
+#define RECORD_PATH "games.cbr"		// binary game archive, see game_record.cpp for the format
+#define PGN_PATH "games.pgn"		// portable game notation export of the same games
+#define TOURNAMENT_MODE false		// if true the program plays TOURNAMENT_GAMES bot vs bot games concurrently across TOURNAMENT_WORKERS threads and exits
+#define TOURNAMENT_GAMES 100		// number of independent games the tournament scheduler plays
+#define TOURNAMENT_WORKERS 4		// worker threads playing games side by side, combine with SEARCH_THREADS 1 so the cores are not oversubscribed
+#define OPENING_BOOK true			// if true the bots play weighted book moves while the position is in the opening book, skipping the search
+#define BOOK_FILE "book.cbk"		// opening book file, a BookEntry array sorted by key, a missing file simply disables the book
+#define SEARCH_INFO false			// if true the bot prints one statistics line after every searched move, the counters themselves always stay enabled
+#define BENCHMARK_MODE false		// if true the program searches the benchmark positions at BENCHMARK_DEPTH, prints nodes/sec and time-to-depth and exits
+#define BENCHMARK_DEPTH 6			// fixed search depth of the benchmark run, deep enough that the search dominates the measurement
+#define MATCH_MODE false			// if true the program plays MATCH_PAIRS paired A vs B games from shared openings and reports the score with a confidence interval
+#define MATCH_PAIRS 25				// number of game pairs, each opening is played once with either configuration as white
+#define MATCH_A_DIFFICULTY 3		// search depth of configuration A, the baseline
+#define MATCH_B_DIFFICULTY 3		// search depth of configuration B, the candidate
+#define UCI_MODE false				// if true the program speaks the Universal Chess Interface on stdin/stdout instead of drawing the console game
+
+// types of chess pieces
+typedef enum {
+    B_KING = -6, B_QUEEN, B_BISHOP, B_KNIGHT, B_ROOK, B_PAWN, EMPTY,
+    W_KING, W_QUEEN, W_BISHOP, W_KNIGHT, W_ROOK, W_PAWN
+} ChessPieces;
+
+// a 64-bit occupancy mask, one bit per board square (bit index = y*BOARD_SIZE + x)
+typedef unsigned long long Bitboard;
+
+// ray directions for sliding-piece attacks, the first four increase the square index and the last four decrease it
+typedef enum {
+    EAST, SOUTH, SOUTH_WEST, SOUTH_EAST, WEST, NORTH, NORTH_EAST, NORTH_WEST
+} Rays;
+
+// types of player moves
+typedef enum {
+    NORMAL, CASTLING, PROMOTION, EN_PASSANT
+} Moves;
+
+// bound types of the scores stored in the transposition table
+typedef enum {
+    EXACT, LOWER_BOUND, UPPER_BOUND
+} Bounds;
+
+// possible options on how the game can end
+typedef enum {
+    CHECKMATE, FIFTY_MOVES, THREEFOLD_REP, QUIT, ONGOING
+} Endgame;
+
+// starting position of the board
+const char STARTING_BOARD[BOARD_SIZE][BOARD_SIZE] = {{B_ROOK, B_KNIGHT, B_BISHOP, B_QUEEN, B_KING, B_BISHOP, B_KNIGHT, B_ROOK},
+                                                     {B_PAWN, B_PAWN, B_PAWN, B_PAWN, B_PAWN, B_PAWN, B_PAWN, B_PAWN},
+                                                     {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY},
+                                                     {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY},
+                                                     {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY},
+                                                     {EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY, EMPTY},
+                                                     {W_PAWN, W_PAWN, W_PAWN, W_PAWN, W_PAWN, W_PAWN, W_PAWN, W_PAWN},
+                                                     {W_ROOK, W_KNIGHT, W_BISHOP, W_QUEEN, W_KING, W_BISHOP, W_KNIGHT, W_ROOK}};
+
+class Player;
+class Renderer;
+class PathNode;
+class Bot;
+class Chess;
+class TranspositionTable;
+
+#include <string>
+#include <forward_list>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+// double-buffered console renderer, composes frames in memory and flushes only the changed rows with a single console call
+class Renderer {
+private:
+    std::vector<char> front_buffer;		// mirror of what the console currently shows
+    std::vector<char> back_buffer;		// the frame being composed
+public:
+    Renderer() noexcept;
+    void Clear() noexcept;
+    void Invalidate() noexcept;
+    void Write(const short &x, const short &y, const std::string &text) noexcept;
+    void Present() noexcept;
+};
+
+// a packed POD chess move: bits 0-5 hold the from square, bits 6-11 the to square, bits 12-13 the move kind
+struct Move {
+    unsigned short data = 0;
+    Move() noexcept = default;
+    Move(const short &x1, const short &y1, const short &x2, const short &y2, const Moves &kind = NORMAL) noexcept;
+    short FromX() const noexcept;
+    short FromY() const noexcept;
+    short ToX() const noexcept;
+    short ToY() const noexcept;
+    Moves Kind() const noexcept;
+    std::string ToText() const noexcept;
+    bool operator== (const Move &m) const noexcept;
+    bool operator< (const Move &m) const noexcept;
+};
+
+// per-ply undo record of everything a move destroys, POD so the search's make/unmake never touches the game history strings
+struct UndoState {
+    Moves kind;					// what sort of move was made
+    char moved;					// the piece that left the from square
+    char captured;				// the piece that stood on the target square, EMPTY for en passant captures
+    bool castling_right;		// the mover's castling flag before the move
+    short en_passant_file;		// the en passant file before the move, -1 when there was none
+};
+
+// a compact, trivially copyable snapshot of the game state, cheap to keep on the stack and restore without per-move undo logic
+struct Position {
+    char board[BOARD_SIZE][BOARD_SIZE];
+    Bitboard piece_boards[13];
+    Bitboard color_boards[2];
+    unsigned long long zobrist_key;
+    float evaluation;
+    bool whites_turn;
+    bool white_castling, black_castling;
+    unsigned short moves_after_last_pawn_move_or_capture;
+    short en_passant_file;
+    size_t game_move_count;			// sizes of the move, key and undo records at save time, "RestorePosition" rolls the vectors back to them
+    size_t key_history_size;
+    size_t undo_history_size;
+};
+
+// a transposition table entry: the position key, the stored score with its bound type, the remaining search depth and the best move found
+struct TTEntry {
+    unsigned long long key = 0;
+    float score = 0;
+    unsigned short depth = 0;
+    char bound = EXACT;
+    Move best_move;
+};
+
+// transposition table class declaration
+class TranspositionTable {
+private:
+    std::vector<TTEntry> entries;	// power-of-two sized bucket array indexed by the low bits of the position key
+    unsigned long long mask;		// entry count minus one, used to map keys onto buckets
+    mutable std::mutex locks[64];	// striped locks so concurrent search threads can share the table
+public:
+    TranspositionTable(const unsigned short &megabytes) noexcept;
+    bool Probe(const unsigned long long &key, TTEntry &entry) const noexcept;
+    void Store(const unsigned long long &key, const float &score, const unsigned short &depth, const char &bound, const Move &best_move) noexcept;
+    void Clear() noexcept;
+};
+
+// small xoshiro256** generator owned per game, deterministic from its seed so any batch game can be replayed bit for bit
+class RandomGenerator {
+private:
+    unsigned long long state[4];	// the four xoshiro256** state words
+    unsigned long long seed;		// the seed the stream started from, recorded in the game record for replays
+public:
+    RandomGenerator(const unsigned long long &seed = 0) noexcept;
+    void Seed(unsigned long long new_seed) noexcept;
+    unsigned long long GetSeed() const noexcept;
+    unsigned long long Next() noexcept;
+    unsigned short Below(const unsigned short &bound) noexcept;
+};
+
+// one opening book entry, the book file on disk is an array of these sorted by key
+struct BookEntry {
+    unsigned long long key;		// zobrist key of the position, as returned by GetZobristKey
+    unsigned short move;		// packed Move encoding of the candidate reply
+    unsigned short weight;		// relative playing frequency of the reply, higher is played more often
+    unsigned short padding[2];	// keeps the entry 16 bytes so the file maps directly onto this struct
+};
+
+// read-only opening book, memory-maps a file of weighted candidate moves keyed by position hash
+class OpeningBook {
+private:
+    const BookEntry *entries = nullptr;		// points straight into the mapped file, which stays mapped for the lifetime of the process
+    unsigned long long count = 0;
+public:
+    OpeningBook(const std::string &path) noexcept;
+    Move Probe(const unsigned long long &key, RandomGenerator &random) const noexcept;
+};
+
+// player class declaration
+class Player {
+protected:
+    std::string name;			// name of the player
+    unsigned short score = 0;	// score of the player
+    bool castling = true;		// if true the player can castle, if false the player cannot castle anymore during the game
+public:
+    Player(const std::string &name) noexcept;
+    std::string GetName() const noexcept;
+    unsigned short GetScore() const noexcept;
+    bool GetCastling() const noexcept;
+    void SetCastling(const bool &castling) noexcept;
+    void IncreaseScore(const unsigned short &inc) noexcept;
+    void Reset() noexcept;
+    bool operator== (const Player &p) const noexcept;
+};
+
+// counters describing one root search, cheap enough to stay enabled in production runs
+struct SearchStats {
+    unsigned long long nodes = 0;				// alpha-beta and quiescence nodes visited
+    unsigned long long evaluations = 0;			// static evaluations at the leaves
+    unsigned long long beta_cutoffs = 0;		// nodes that failed high
+    unsigned long long first_move_cutoffs = 0;	// cutoffs produced by the first move searched, measures the move ordering quality
+    unsigned long long tt_hits = 0;				// transposition table probes that found a deep enough entry
+    unsigned short max_depth = 0;				// deepest fully completed search depth
+    long long elapsed_ms = 0;					// wall clock time of the whole search
+};
+
+// path node class declaration
+class PathNode {
+private:
+    static TranspositionTable transposition_table;		// cache of already searched positions, shared by every search
+    std::atomic<bool> stop_search = false;				// set once the time budget runs out, makes every worker of THIS search abort as soon as possible
+    std::atomic<std::chrono::steady_clock::time_point> search_deadline{};	// the point in time at which this node's running search must stop
+    void CreateSubtree(Chess &c, const unsigned short &depth, const Move &tt_move) noexcept;
+    float Quiescence(Chess &c, float alpha, float beta, const bool &maximizing_player, const bool &initial_turn) noexcept;
+    float AlphaBeta(Chess &c, unsigned short &depth, float alpha, float beta, const bool &maximizing_player, const bool &initial_turn) noexcept;
+    Move SearchRoot(Chess &c, const std::vector<Move> &root_moves, unsigned short depth, float &best_score) noexcept;
+public:
+    PathNode() noexcept = default;
+    PathNode(const PathNode &) noexcept {	}					// the time control is per search, a copied node starts with its own
+    PathNode& operator= (const PathNode &) noexcept { return *this; }
+    Move AlphaBetaRoot(Chess &c, unsigned short &difficulty) noexcept;
+    Move IterativeDeepening(Chess &c, const unsigned short &budget_ms) noexcept;
+    static void StartPondering(const Chess &c) noexcept;
+    static void StopPondering() noexcept;
+    static SearchStats GetSearchStats() noexcept;
+    static void ClearTranspositionTable() noexcept;
+    void StopSearch() noexcept;
+    bool SearchStopped() noexcept;
+};
+
+// bot class declaration, which inherits from player class
+class Bot : public Player {
+private:
+    PathNode root;					// the root node of the bot's decision tree
+    unsigned short difficulty;		// the depth of the bot's decision tree
+public:
+    Bot(const std::string &name, const unsigned short &difficulty) noexcept;
+    unsigned short GetDifficulty() const noexcept;
+    Move GetIdealMove(Chess &c) noexcept;
+    Move GetIdealMove(Chess &c, unsigned short difficulty) noexcept;
+    bool operator== (const Bot &b) const noexcept;
+};
+
+// chess class declaration
+class Chess {
+private:
+    char board[BOARD_SIZE][BOARD_SIZE];		// game board
+    Bot white, black;						// teams
+    std::vector<std::pair<Moves, std::string>> all_game_moves;		// a record which contains all the moves played throughout the game in chronological order
+    bool whites_turn = true;				// if true then it's team white's turn, if false then it's team black's turn
+    unsigned short moves_after_last_pawn_move_or_capture = 0;		// number of moves played after a pawn moved or a capture happened
+    Bitboard piece_boards[13];				// one occupancy mask per piece type, indexed by piece value + 6 (index 6, the EMPTY slot, stays unused)
+    Bitboard color_boards[2];				// one occupancy mask per team, indexed by piece color (0: black, 1: white)
+    unsigned long long zobrist_key = 0;		// incrementally maintained zobrist hash of the pieces and the side to move
+    std::vector<unsigned long long> key_history;	// zobrist key of every position since the game started, the last element is the current position
+    std::vector<UndoState> undo_history;	// per-ply undo stack for make/unmake, POD only so the search never grows strings
+    std::vector<Move> move_cache;			// legal moves of the current position, filled on demand and kept until the position changes
+    bool move_cache_valid = false;
+    RandomGenerator random_generator;		// every game owns its own stream, no hidden global shared across concurrent games
+    short en_passant_file = -1;				// file of the pawn that just double pushed, -1 when en passant is not available
+    float evaluation = 0;					// incrementally maintained material+position score of the board, positive when white is ahead
+    static bool WithinBounds(const short &coord) noexcept;
+    static short ToSquare(const short &x, const short &y) noexcept;
+    static short BitScanForward(const Bitboard &bits) noexcept;
+    static short BitScanReverse(Bitboard bits) noexcept;
+    static Bitboard RayAttacks(const short &direction, const short &square, const Bitboard &occupied) noexcept;
+    static Bitboard RookAttacks(const short &square, const Bitboard &occupied) noexcept;
+    static Bitboard BishopAttacks(const short &square, const Bitboard &occupied) noexcept;
+    static Bitboard QueenAttacks(const short &square, const Bitboard &occupied) noexcept;
+    void SetPiece(const short &x, const short &y, const char &piece) noexcept;
+    void RebuildBitboards() noexcept;
+    static void ChangeToString(char &x1, char &y1, char &x2, char &y2) noexcept;
+    static std::string ToString(const short &x1, const short &y1, const short &x2, const short &y2) noexcept;
+    static std::string PieceNameToString(const char &piece) noexcept;
+    static float PieceSquareValue(const char &piece, const short &x, const short &y) noexcept;
+    static void ClearAllMoves(const unsigned short &n) noexcept;
+    static void CopyBoard(const char from[BOARD_SIZE][BOARD_SIZE], char to[BOARD_SIZE][BOARD_SIZE]) noexcept;
+    static bool CanMovePiece(const short &x1, const short &y1, const short &x2, const short &y2, const std::vector<Move> &all_moves) noexcept;
+    Bot& GetCurrentPlayer() noexcept;
+    Bot GetCurrentPlayerConst() const noexcept;
+    Bot& GetOtherPlayer() noexcept;
+    Bot GetOtherPlayerConst() const noexcept;
+    void ChangeTurn() noexcept;
+    void AppendToAllGameMoves(const short &x1, const short &y1, const short &x2, const short &y2) noexcept;
+    void Reset(const bool &clear_screen = true) noexcept;
+    void CheckCoordinates(const short &x, const short &y, const std::string &func_name) const noexcept(false);
+    bool EndGameText(const unsigned short &n, const Endgame &end_game) const noexcept;
+    short GetEnPassant(const short &x, const short &y) const noexcept;
+    bool ThreefoldRepetition() const noexcept;
+    bool IsCheck(const Move &move) noexcept;
+    void ComputeLegalityMasks(Bitboard &check_mask, Bitboard &pinned, Bitboard (&pin_allowed)[BOARD_SIZE*BOARD_SIZE]) const noexcept;
+    void PawnMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept;
+    void RookMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept;
+    void KnightMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept;
+    void BishopMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept;
+    void QueenMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept;
+    void KingMoves(const short &x, const short &y, std::vector<Move> &all_moves) const noexcept;
+    Move GetRandomMove() noexcept;
+    char ManuallyPromotePawn() const noexcept;
+    void UpdateBoard(const short &x, const short &y) const noexcept;
+    void UpdateScore(const Bot &p) const noexcept;
+    float EvaluatePosition(const short &x, const short &y) const noexcept;
+    void PrintAllMovesMadeInOrder() const noexcept;
+    Endgame DetectEndgame() noexcept;
+    bool CheckEndgame(const unsigned short &n = 0) noexcept;
+    Endgame PlayBotMove() noexcept;
+public:
+    Chess(const std::string &player1, const unsigned short &difficulty1, const std::string &player2, const unsigned short &difficulty2) noexcept;
+    Chess(const std::string &player1, const unsigned short &difficulty1, const std::string &player2, const unsigned short &difficulty2, const std::string &fen) noexcept;
+    void SetPosition(const std::string &fen) noexcept;
+    std::string ToFEN() const noexcept;
+    Position SavePosition() const noexcept;
+    void RestorePosition(const Position &position) noexcept;
+    static void ChangeToRealCoordinates(char &x1, char &y1, char &x2, char &y2) noexcept;
+    static float EvaluatePiece(const char &piece) noexcept;
+    char GetPiece(const short &x, const short &y) const noexcept;
+    bool GetTurn() const noexcept;
+    unsigned long long GetZobristKey() const noexcept;
+    RandomGenerator& GetRandomGenerator() noexcept;
+    bool HasMajorPieces() const noexcept;
+    bool IsCheck(const bool &turn) const noexcept;
+    std::vector<Move> AllMoves() noexcept;
+    void AllMoves(std::vector<Move> &all_moves) noexcept;
+    void PseudoLegalMoves(std::vector<Move> &all_moves) noexcept;
+    bool HasLegalMove() noexcept;
+    void MovePiece(const short &x1, const short &y1, const short &x2, const short &y2, const bool &manual_promotion, const bool &update_board) noexcept;
+    void MovePiece(const Move &move, const bool &manual_promotion, const bool &update_board) noexcept;
+    void MakeMove(const Move &move, const char &promotion = EMPTY) noexcept;
+    void UnmakeMove(const Move &move) noexcept;
+    void MakeNullMove() noexcept;
+    void UnmakeNullMove() noexcept;
+    float EvaluateBoard(const bool &turn) const noexcept;
+    float EvaluateBoardFull() const noexcept;
+    void PrintBoard() const noexcept;
+    bool PlayersTurn() noexcept;
+    bool BotsTurn() noexcept;
+    bool GameOver() noexcept;
+    static void PlayHeadlessGames(const unsigned short &number_of_games) noexcept;
+    static void PlayTournament(const unsigned short &number_of_games, const unsigned short &workers) noexcept;
+    unsigned long long Perft(const unsigned short &depth) noexcept;
+    static void RunPerft(const unsigned short &depth) noexcept;
+    static void RunBenchmark(const unsigned short &depth) noexcept;
+    static void PlayMatch(const unsigned short &number_of_pairs) noexcept;
+    static void RunUci() noexcept;
+    void SaveGameRecord(const Endgame &result) const noexcept;
+    void SavePGN(const Endgame &result) const noexcept;
+    std::string ToPGN(const Endgame &result) const noexcept;
+};
+
+// other function declarations
+void MoveCursorToXY(const short &x, const short &y) noexcept;
+std::string ToLowerString(std::string s) noexcept;
+
+#endif //CHESSBOT_CHESS_H
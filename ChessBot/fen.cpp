@@ -0,0 +1,77 @@
+#include "chess.h"
+#include <sstream>
+
+// FEN import and export, drops the engine into arbitrary positions without replaying moves
+
+// the piece letters of FEN notation, indexed by piece value + 6
+static const std::string FEN_PIECES = "kqbnrp KQBNRP";
+
+// constructor overload, starts from the position described by the given FEN string instead of the starting board
+Chess::Chess(const std::string &player1, const unsigned short &difficulty1, const std::string &player2, const unsigned short &difficulty2, const std::string &fen) noexcept
+        : white(player1, difficulty1), black(player2, difficulty2) {
+    SetPosition(fen);
+}
+
+// loads the position described by the given FEN string, replacing the entire game state,
+// out-of-range squares and unknown letters of a malformed string are skipped instead of trusted
+void Chess::SetPosition(const std::string &fen) noexcept {
+    std::istringstream fields(fen);
+    std::string pieces, side, castling, en_passant;
+    unsigned short halfmove_clock = 0;
+    fields >> pieces >> side >> castling >> en_passant >> halfmove_clock;		// the trailing fullmove number stays unread, nothing tracks it
+    short x = 0, y = 0;
+    for(const auto &ch : pieces) {
+        if(ch == '/')
+            x = 0, ++y;
+        else if(isdigit(ch))
+            for(short i=0;i<ch-'0' && WithinBounds(x) && WithinBounds(y);++i)
+                board[y][x++] = EMPTY;
+        else {
+            const size_t &piece = FEN_PIECES.find(ch);
+            if(piece != std::string::npos && WithinBounds(x) && WithinBounds(y))
+                board[y][x++] = static_cast<char>(piece) - 6;
+        }
+    }
+    whites_turn = side == "w";
+    white.SetCastling(castling.find_first_of("KQ") != std::string::npos);	// one flag covers both of a player's castling rights
+    black.SetCastling(castling.find_first_of("kq") != std::string::npos);
+    all_game_moves.clear();
+    undo_history.clear();
+    en_passant_file = en_passant.length() == 2 && en_passant[0] >= 'a' && en_passant[0] < 'a' + BOARD_SIZE ? en_passant[0] - 'a' : -1;
+    moves_after_last_pawn_move_or_capture = halfmove_clock;
+    RebuildBitboards();
+    key_history.assign(1, GetZobristKey());
+}
+
+// returns the FEN string describing the current position
+std::string Chess::ToFEN() const noexcept {
+    std::string fen;
+    for(short y=0;y<BOARD_SIZE;++y) {
+        short empty_run = 0;
+        for(short x=0;x<BOARD_SIZE;++x) {
+            if(board[y][x] == EMPTY) {
+                ++empty_run;
+                continue;
+            }
+            if(empty_run)
+                fen += static_cast<char>('0' + empty_run), empty_run = 0;
+            fen += FEN_PIECES[board[y][x] + 6];
+        }
+        if(empty_run)
+            fen += static_cast<char>('0' + empty_run);
+        if(y < BOARD_SIZE-1)
+            fen += '/';
+    }
+    fen += whites_turn ? " w " : " b ";
+    std::string castling;
+    if(white.GetCastling())
+        castling += "KQ";			// the single castling flag cannot tell kingside and queenside apart
+    if(black.GetCastling())
+        castling += "kq";
+    fen += castling.empty() ? "-" : castling;
+    std::string en_passant = "-";
+    if(en_passant_file != -1)
+        en_passant = {static_cast<char>('a' + en_passant_file), whites_turn ? '6' : '3'};
+    fen += " " + en_passant + " " + std::to_string(moves_after_last_pawn_move_or_capture) + " " + std::to_string(all_game_moves.size()/2 + 1);
+    return fen;
+}
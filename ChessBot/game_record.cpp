@@ -0,0 +1,95 @@
+#include "chess.h"
+#include <fstream>
+#include <mutex>
+
+// binary game records and PGN export, lets batch runs archive games at disk bandwidth instead of console-print speed
+//
+// archive format, one record per game, all integers little endian:
+//   4 bytes   magic "CBR2"
+//   1 byte    result (the Endgame enum value)
+//   8 bytes   seed of the game's random stream, replaying the moves with it reproduces the game bit for bit
+//   2 bytes   white: random flag and difficulty
+//   2 bytes   black: random flag and difficulty
+//   2 bytes   number of moves
+//   2 bytes   per move, the packed Move encoding (from, to and kind bit fields)
+
+// serializes appends to the output files, tournament workers finish games concurrently
+static std::mutex record_lock;
+
+// the PGN letter of every piece, indexed by piece value + 6, both colors use the uppercase letters
+static const std::string PGN_PIECES = "KQBNRP KQBNRP";
+
+// rebuilds the packed moves of the finished game from the move records
+static std::vector<Move> PackedGameMoves(const std::vector<std::pair<Moves, std::string>> &all_game_moves) noexcept {
+    std::vector<Move> moves;
+    moves.reserve(all_game_moves.size());
+    bool turn = true;
+    for(const auto &game_move : all_game_moves) {
+        if(game_move.first == CASTLING)		// castling records only store the king's target file
+            moves.emplace_back(4, (BOARD_SIZE-1)*turn, game_move.second[0], (BOARD_SIZE-1)*turn, CASTLING);
+        else {
+            char x1 = game_move.second[0], y1 = game_move.second[1], x2 = game_move.second[2], y2 = game_move.second[3];
+            Chess::ChangeToRealCoordinates(x1, y1, x2, y2);
+            moves.emplace_back(x1, y1, x2, y2, game_move.first);
+        }
+        turn = !turn;
+    }
+    return moves;
+}
+
+// appends the finished game to the binary archive, the stream stays open and buffered across games
+void Chess::SaveGameRecord(const Endgame &result) const noexcept {
+    std::lock_guard<std::mutex> guard(record_lock);
+    static std::ofstream archive(RECORD_PATH, std::ios::binary | std::ios::app);
+    if(!archive)
+        return;
+    const auto &moves = PackedGameMoves(all_game_moves);
+    const unsigned short &white_config = WHITE_BOT_RANDOM << 15 | white.GetDifficulty();
+    const unsigned short &black_config = BLACK_BOT_RANDOM << 15 | black.GetDifficulty();
+    const unsigned short &move_count = moves.size();
+    archive.write("CBR2", 4);
+    archive.put(static_cast<char>(result));
+    const unsigned long long &seed = random_generator.GetSeed();
+    archive.write(reinterpret_cast<const char*>(&seed), 8);
+    archive.write(reinterpret_cast<const char*>(&white_config), 2);
+    archive.write(reinterpret_cast<const char*>(&black_config), 2);
+    archive.write(reinterpret_cast<const char*>(&move_count), 2);
+    for(const auto &move : moves)
+        archive.write(reinterpret_cast<const char*>(&move.data), 2);
+}
+
+// appends the finished game to the PGN file
+void Chess::SavePGN(const Endgame &result) const noexcept {
+    std::lock_guard<std::mutex> guard(record_lock);
+    static std::ofstream pgn_file(PGN_PATH, std::ios::app);
+    if(pgn_file)
+        pgn_file << ToPGN(result) << std::endl;
+}
+
+// returns the finished game in PGN form, the moves use long algebraic notation so no disambiguation pass is needed
+std::string Chess::ToPGN(const Endgame &result) const noexcept {
+    const std::string &score = result == CHECKMATE ? (whites_turn ? "0-1" : "1-0") : "1/2-1/2";		// after the mating move it is the loser's turn
+    std::string pgn = "[White \"" + white.GetName() + "\"]\n[Black \"" + black.GetName() + "\"]\n[Result \"" + score + "\"]\n\n";
+    bool turn = true;
+    unsigned short move_number = 1;
+    for(const auto &game_move : all_game_moves) {
+        if(turn)
+            pgn += std::to_string(move_number++) + ". ";
+        if(game_move.first == CASTLING)
+            pgn += game_move.second[0] == 2 ? "O-O-O" : "O-O";
+        else {
+            const char &piece = game_move.second[4];
+            if(piece != W_PAWN && piece != B_PAWN)
+                pgn += PGN_PIECES[piece + 6];
+            pgn += game_move.second.substr(0, 2);
+            if(game_move.second[5] != EMPTY || game_move.first == EN_PASSANT)
+                pgn += 'x';
+            pgn += game_move.second.substr(2, 2);
+            if(game_move.first == PROMOTION)
+                pgn += std::string("=") + PGN_PIECES[game_move.second[6] + 6];
+        }
+        pgn += ' ';
+        turn = !turn;
+    }
+    return pgn + score;
+}
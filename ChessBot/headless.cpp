@@ -0,0 +1,46 @@
+#include "chess.h"
+#include <iostream>
+
+// headless batch self-play runner, plays bot vs bot games back to back without the console renderer
+
+// plays one bot move without touching the console, returns the state of the game afterwards
+Endgame Chess::PlayBotMove() noexcept {
+    const auto &move = (whites_turn ? WHITE_BOT_RANDOM : BLACK_BOT_RANDOM) ? GetRandomMove() : GetCurrentPlayer().GetIdealMove(*this);
+    MovePiece(move, false, false);
+    return DetectEndgame();
+}
+
+// plays the given number of bot vs bot games back to back and prints a single summary at the end
+void Chess::PlayHeadlessGames(const unsigned short &number_of_games) noexcept {
+    Chess c("White bot", WHITE_BOT_DIFFICULTY, "Black bot", BLACK_BOT_DIFFICULTY);
+    unsigned short white_wins = 0, black_wins = 0, draws = 0;
+    std::vector<unsigned short> game_moves;		// per-game statistics, kept in memory until the summary at the end
+    std::vector<long long> game_times;
+    game_moves.reserve(number_of_games);
+    game_times.reserve(number_of_games);
+    for(unsigned short game=0;game<number_of_games;++game) {
+        const auto &game_start = std::chrono::steady_clock::now();
+        unsigned short moves = 0;
+        Endgame end_game;
+        do
+            end_game = c.PlayBotMove(), ++moves;
+        while(end_game == ONGOING);
+        end_game == CHECKMATE ? ++(c.whites_turn ? black_wins : white_wins) : ++draws;		// after the mating move it is the loser's turn
+        if(RECORD_GAMES) {
+            c.SaveGameRecord(end_game);
+            c.SavePGN(end_game);
+        }
+        game_moves.push_back(moves);
+        game_times.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - game_start).count());
+        c.Reset(false);
+    }
+    unsigned long long total_moves = 0, total_time = 0;
+    for(unsigned short game=0;game<number_of_games;++game) {
+        total_moves += game_moves[game];
+        total_time += game_times[game];
+    }
+    std::cout << "Played " << number_of_games << " games in " << total_time/1000.0 << " seconds" << std::endl;
+    std::cout << "White wins: " << white_wins << ", black wins: " << black_wins << ", draws: " << draws << std::endl;
+    std::cout << "Moves played: " << total_moves << " (" << total_moves/(float)number_of_games << " per game, ";
+    std::cout << (total_moves ? total_time/(float)total_moves : 0) << " ms per move)" << std::endl;
+}
@@ -1,12 +1,38 @@
 #include "chess.h"
 #include <iostream>
-#include <time.h>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 
 int main() {
-    srand((unsigned int)time(NULL));
+    if(PERFT_MODE) {					// count move-tree leaf nodes instead of playing
+        Chess::RunPerft(PERFT_DEPTH);
+        return 0;
+    }
+    if(UCI_MODE) {						// speak the UCI protocol instead of drawing the console game
+        Chess::RunUci();
+        return 0;
+    }
+    if(BENCHMARK_MODE) {				// measure search speed on the fixed benchmark positions
+        Chess::RunBenchmark(BENCHMARK_DEPTH);
+        return 0;
+    }
+    if(MATCH_MODE) {					// measure playing strength of configuration A against B
+        Chess::PlayMatch(MATCH_PAIRS);
+        return 0;
+    }
+    if(TOURNAMENT_MODE) {				// concurrent batch self-play across a worker pool
+        Chess::PlayTournament(TOURNAMENT_GAMES, TOURNAMENT_WORKERS);
+        return 0;
+    }
+    if(HEADLESS_MODE) {					// batch self-play without the console renderer
+        Chess::PlayHeadlessGames(HEADLESS_GAMES);
+        return 0;
+    }
     Chess c("Jan", WHITE_BOT_DIFFICULTY, "BOT", BLACK_BOT_DIFFICULTY);
+#ifdef _WIN32
     ShowWindow(GetConsoleWindow(), SW_MAXIMIZE);
+#endif
     if(AGAINST_BOT) {
         do {
             c.PrintBoard();
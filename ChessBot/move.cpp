@@ -0,0 +1,47 @@
+#include "chess.h"
+
+// move struct implementation
+
+// move constructor, packs the from and to coordinates and the move kind into 16 bits
+Move::Move(const short &x1, const short &y1, const short &x2, const short &y2, const Moves &kind) noexcept
+        : data((y1*BOARD_SIZE + x1) | ((y2*BOARD_SIZE + x2) << 6) | (kind << 12)) {	}
+
+// getter method, unpacks the x coordinate of the from square
+short Move::FromX() const noexcept {
+    return (data & 63) % BOARD_SIZE;
+}
+
+// getter method, unpacks the y coordinate of the from square
+short Move::FromY() const noexcept {
+    return (data & 63) / BOARD_SIZE;
+}
+
+// getter method, unpacks the x coordinate of the to square
+short Move::ToX() const noexcept {
+    return ((data >> 6) & 63) % BOARD_SIZE;
+}
+
+// getter method, unpacks the y coordinate of the to square
+short Move::ToY() const noexcept {
+    return ((data >> 6) & 63) / BOARD_SIZE;
+}
+
+// getter method, unpacks the move kind
+Moves Move::Kind() const noexcept {
+    return static_cast<Moves>(data >> 12);
+}
+
+// returns the move as an ASCII coordinate string for the UI, e.g. "e2e4"
+std::string Move::ToText() const noexcept {
+    return {static_cast<char>(FromX()+'a'), static_cast<char>('8'-FromY()), static_cast<char>(ToX()+'a'), static_cast<char>('8'-ToY())};
+}
+
+// operator overload for '==', the move kind bits are ignored since the from and to squares identify the move
+bool Move::operator== (const Move &m) const noexcept {
+    return (data & 4095) == (m.data & 4095);
+}
+
+// operator overload for '<', consistent with '==' so the struct can be used as an ordered key
+bool Move::operator< (const Move &m) const noexcept {
+    return (data & 4095) < (m.data & 4095);
+}
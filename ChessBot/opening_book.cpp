@@ -0,0 +1,65 @@
+#include "chess.h"
+#include <algorithm>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// opening book class implementation
+
+// opening book constructor, memory-maps the given file, a missing or empty file leaves the book empty
+OpeningBook::OpeningBook(const std::string &path) noexcept {
+#ifdef _WIN32
+    const HANDLE &file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if(file == INVALID_HANDLE_VALUE)
+        return;
+    const DWORD &size = GetFileSize(file, NULL);
+    const HANDLE &mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if(mapping) {
+        const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if(view) {
+            entries = static_cast<const BookEntry*>(view);
+            count = size / sizeof(BookEntry);
+        }
+        CloseHandle(mapping);		// the view keeps the mapping alive, it is never unmapped
+    }
+    CloseHandle(file);
+#else
+    const int &file = open(path.c_str(), O_RDONLY);
+    if(file == -1)
+        return;
+    struct stat info;
+    if(!fstat(file, &info) && info.st_size) {
+        const void *view = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if(view != MAP_FAILED) {
+            entries = static_cast<const BookEntry*>(view);
+            count = info.st_size / sizeof(BookEntry);
+        }
+    }
+    close(file);		// the mapping keeps the file contents alive, it is never unmapped
+#endif
+}
+
+// returns a weighted random candidate move for the given position, or an empty move when the position is not in the book
+Move OpeningBook::Probe(const unsigned long long &key, RandomGenerator &random) const noexcept {
+    const BookEntry *end = entries + count;
+    const BookEntry *entry = std::lower_bound(entries, end, key, [](const BookEntry &e, const unsigned long long &k) { return e.key < k; });
+    unsigned long long total_weight = 0;
+    for(const BookEntry *candidate = entry; candidate != end && candidate->key == key; ++candidate)
+        total_weight += candidate->weight;
+    Move move;
+    if(!total_weight)
+        return move;
+    unsigned long long target = total_weight * random.Below(65535) / 65535;	// scaled draw, the weights may sum past a single draw's range
+    for(; entry != end && entry->key == key; ++entry) {
+        move.data = entry->move;
+        if(target < entry->weight)
+            break;
+        target -= entry->weight;
+    }
+    return move;
+}
@@ -1,63 +1,372 @@
-#include "chess.h"
-
-// path node class implementation
-
-// creates a subtree which contains all possible moves the player can make
-void PathNode::CreateSubtree(Chess &c) noexcept {
-    auto all_moves = c.AllMoves();					// add all possible moves to the Node's map
-    for(auto &move : all_moves) {
-        Chess::ChangeToRealCoordinates(move[0], move[1], move[2], move[3]);
-        child_node_list.emplace(move, PathNode());
-    }
-}
-
-// returns the maximum score for the minimizing player and the minimum score for the maximizing player in each recursion
-float PathNode::AlphaBeta(Chess &c, unsigned short &depth, float alpha, float beta, const bool &maximizing_player, const bool &initial_turn) noexcept {
-    if(!depth)
-        return c.EvaluateBoard(initial_turn);
-    CreateSubtree(c);
-    float points = maximizing_player ? -9999 : 9999;
-    for(auto &node : child_node_list) {						// 1-0: from, 3-2: to
-        if(c.GetPiece(node.first[2], node.first[3]) == W_KING - 7*c.GetTurn()) {
-            child_node_list.clear();
-            return maximizing_player ? 9999 : -9999;		// if my target piece is king, then it is the most rewarding move
-        }
-        c.MovePiece(node.first[0], node.first[1], node.first[2], node.first[3], false, false);
-        points = maximizing_player ? std::max(points, node.second.AlphaBeta(c, --depth, alpha, beta, false, initial_turn))		// recursive alpha-beta algorithm
-                                   : std::min(points, node.second.AlphaBeta(c, --depth, alpha, beta, true, initial_turn));
-        maximizing_player ? alpha = std::max(alpha, points) : beta = std::min(beta, points);
-        ++depth;
-        c.MovePieceBack(node.first[0], node.first[1], node.first[2], node.first[3]);
-        if(alpha >= beta)
-            break;
-    }
-    child_node_list.clear();
-    return points;
-}
-
-// the main function which returns the optimal move calculated by the alpha-beta algorithm
-std::string PathNode::AlphaBetaRoot(Chess &c, unsigned short &difficulty) noexcept {
-    CreateSubtree(c);
-    std::vector<std::string> ideal_moves;
-    float max_move_score = -9999;
-    for(auto &node : child_node_list) {
-        if(c.GetPiece(node.first[2], node.first[3]) == W_KING - 7*c.GetTurn()) {
-            child_node_list.clear();
-            return node.first;						// if my target piece is king, then this move is a game winner so return this move
-        }
-        c.MovePiece(node.first[0], node.first[1], node.first[2], node.first[3], false, false);
-        float move_score = node.second.AlphaBeta(c, difficulty, -10000, 10000, false, !c.GetTurn());
-        if(move_score > max_move_score) {
-            max_move_score = move_score;
-            ideal_moves.clear();
-            ideal_moves.emplace_back(node.first);	// add the most rewarding move to the list
-        }
-        else if(move_score == max_move_score)
-            ideal_moves.emplace_back(node.first);
-        c.MovePieceBack(node.first[0], node.first[1], node.first[2], node.first[3]);
-    }
-    child_node_list.clear();						// delete the whole tree
-    auto move = ideal_moves.cbegin();
-    advance(move, GetRandomNumber<unsigned short>(0, ideal_moves.size()-1));
-    return *move;
-}
\ No newline at end of file
+#include "chess.h"
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+// path node class implementation
+
+// the transposition table shared by every search
+TranspositionTable PathNode::transposition_table(TT_SIZE_MB);
+
+// xored into the position key so that scores evaluated from white's and black's perspective never mix in the table
+static const unsigned long long PERSPECTIVE_KEY = 0x9d39247e33776d41ULL;
+
+// per-thread arena of scored moves shared by every ply of the search, grown once and reused with a pointer bump afterwards
+static thread_local std::vector<std::pair<float, Move>> move_arena;
+
+// killer move and history heuristic tables, thread local so the parallel search workers never contend on them
+static thread_local Move killer_moves[MAX_SEARCH_DEPTH+1][2];
+static thread_local unsigned int history_table[2][BOARD_SIZE*BOARD_SIZE][BOARD_SIZE*BOARD_SIZE];
+
+// halves every history score, recent searches keep their ordering weight but old cutoffs decay
+// instead of accumulating for the lifetime of the thread and outranking the killer and capture tiers
+static void AgeHistoryTable() noexcept {
+    for(auto &side : history_table)
+        for(auto &from : side)
+            for(auto &score : from)
+                score /= 2;
+}
+
+// search counters, each thread accumulates locally and the totals are merged once its part of the search finishes
+static thread_local SearchStats thread_stats;
+static SearchStats search_stats;
+static std::mutex stats_lock;
+
+// adds this thread's counters to the shared totals of the running search and clears them
+static void MergeSearchStats() noexcept {
+    std::lock_guard<std::mutex> guard(stats_lock);
+    search_stats.nodes += thread_stats.nodes;
+    search_stats.evaluations += thread_stats.evaluations;
+    search_stats.beta_cutoffs += thread_stats.beta_cutoffs;
+    search_stats.first_move_cutoffs += thread_stats.first_move_cutoffs;
+    search_stats.tt_hits += thread_stats.tt_hits;
+    thread_stats = SearchStats();
+}
+
+// returns the ordering score of the given move, moves with higher scores are searched first
+static float ScoreMove(const Chess &c, const Move &move, const unsigned short &depth, const Move &tt_move) noexcept {
+    if(move == tt_move)
+        return 1000000;				// the move the transposition table remembers as best comes before everything else
+    const char &victim = c.GetPiece(move.ToX(), move.ToY());
+    if(victim != EMPTY)				// order captures by most valuable victim, least valuable attacker
+        return 100000 + 100*Chess::EvaluatePiece(victim) - Chess::EvaluatePiece(c.GetPiece(move.FromX(), move.FromY()));
+    if(move == killer_moves[depth][0] || move == killer_moves[depth][1])
+        return 90000;				// quiet moves that recently caused a cutoff at this depth
+    return history_table[c.GetTurn()][move.FromY()*BOARD_SIZE + move.FromX()][move.ToY()*BOARD_SIZE + move.ToX()];
+}
+
+// appends the pseudo-legal moves of the player to the arena, sorted so the most promising moves are searched first,
+// legality is tested lazily at make time since a cutoff usually means most of the list is never touched
+void PathNode::CreateSubtree(Chess &c, const unsigned short &depth, const Move &tt_move) noexcept {
+    static thread_local std::vector<Move> scratch_moves;		// generation scratch space, reused between nodes
+    c.PseudoLegalMoves(scratch_moves);
+    const size_t base = move_arena.size();
+    for(const auto &move : scratch_moves)
+        move_arena.emplace_back(ScoreMove(c, move, depth, tt_move), move);
+    std::sort(move_arena.begin() + base, move_arena.end(), [](const std::pair<float, Move> &a, const std::pair<float, Move> &b){ return a.first > b.first; });
+}
+
+// searches only captures and promotions below the main search horizon, so leaf evaluations never land in the middle of an exchange
+float PathNode::Quiescence(Chess &c, float alpha, float beta, const bool &maximizing_player, const bool &initial_turn) noexcept {
+    if(stop_search.load(std::memory_order_relaxed))
+        return maximizing_player ? -9999 : 9999;	// the returned score is never used, the aborted iteration is discarded
+    ++thread_stats.nodes;
+    const float &stand_pat = c.EvaluateBoard(initial_turn);
+    ++thread_stats.evaluations;
+    if(maximizing_player ? stand_pat >= beta : stand_pat <= alpha)
+        return stand_pat;							// the player can always decline the exchange, so the quiet score already cuts off
+    maximizing_player ? alpha = std::max(alpha, stand_pat) : beta = std::min(beta, stand_pat);
+    const size_t base = move_arena.size();
+    CreateSubtree(c, 0, Move());
+    float points = stand_pat;						// standing pat is always an option
+    for(size_t i=base;i<move_arena.size();++i) {
+        const Move move = move_arena[i].second;
+        if(c.GetPiece(move.ToX(), move.ToY()) == EMPTY && move.Kind() != PROMOTION)
+            continue;								// quiet moves are left to the main search
+        if(c.GetPiece(move.ToX(), move.ToY()) == W_KING - 7*c.GetTurn()) {
+            move_arena.resize(base);
+            return maximizing_player ? 9999 : -9999;	// if my target piece is king, then it is the most rewarding move
+        }
+        c.MakeMove(move);
+        if(c.IsCheck(!c.GetTurn())) {		// the move leaves the mover's own king in check, it was never legal
+            c.UnmakeMove(move);
+            continue;
+        }
+        const float &child_points = Quiescence(c, alpha, beta, !maximizing_player, initial_turn);
+        c.UnmakeMove(move);
+        points = maximizing_player ? std::max(points, child_points) : std::min(points, child_points);
+        maximizing_player ? alpha = std::max(alpha, points) : beta = std::min(beta, points);
+        if(alpha >= beta) {
+            ++thread_stats.beta_cutoffs;
+            thread_stats.first_move_cutoffs += i == base;
+            break;
+        }
+    }
+    move_arena.resize(base);
+    return points;
+}
+
+// returns the maximum score for the minimizing player and the minimum score for the maximizing player in each recursion
+float PathNode::AlphaBeta(Chess &c, unsigned short &depth, float alpha, float beta, const bool &maximizing_player, const bool &initial_turn) noexcept {
+    static thread_local unsigned int nodes_until_time_check = 0;
+    if(!(++nodes_until_time_check & 1023) && std::chrono::steady_clock::now() >= search_deadline.load(std::memory_order_relaxed))
+        stop_search.store(true, std::memory_order_relaxed);		// out of time, tell every worker to wind down
+    if(stop_search.load(std::memory_order_relaxed))
+        return maximizing_player ? -9999 : 9999;	// the returned score is never used, the aborted iteration is discarded
+    ++thread_stats.nodes;
+    if(!depth)
+        return Quiescence(c, alpha, beta, maximizing_player, initial_turn);		// resolve pending captures before trusting the evaluation
+    const unsigned long long &key = c.GetZobristKey() ^ (initial_turn ? 0 : PERSPECTIVE_KEY);
+    TTEntry entry;
+    if(transposition_table.Probe(key, entry) && entry.depth >= depth) {			// the position was already searched at least this deep
+        ++thread_stats.tt_hits;
+        if(entry.bound == EXACT)
+            return entry.score;
+        entry.bound == LOWER_BOUND ? alpha = std::max(alpha, entry.score) : beta = std::min(beta, entry.score);
+        if(alpha >= beta)
+            return entry.score;
+    }
+    const bool &in_check = c.IsCheck(c.GetTurn());
+    if(depth >= 3 && !in_check && c.HasMajorPieces()) {		// null-move pruning: if passing the turn still fails high, the real moves will too
+        c.MakeNullMove();
+        unsigned short null_depth = depth - 3;		// the free move plus a reduction of two plies
+        const float &null_score = AlphaBeta(c, null_depth, alpha, beta, !maximizing_player, initial_turn);
+        c.UnmakeNullMove();
+        if(!stop_search.load(std::memory_order_relaxed) && (maximizing_player ? null_score >= beta : null_score <= alpha))
+            return null_score;
+    }
+    const size_t base = move_arena.size();		// this node's moves live in the arena from "base" until it returns
+    CreateSubtree(c, depth, entry.best_move);
+    const float starting_alpha = alpha, starting_beta = beta;
+    float points = maximizing_player ? -9999 : 9999;
+    Move best_move;
+    for(size_t i=base;i<move_arena.size();++i) {
+        const Move move = move_arena[i].second;
+        if(c.GetPiece(move.ToX(), move.ToY()) == W_KING - 7*c.GetTurn()) {
+            move_arena.resize(base);
+            return maximizing_player ? 9999 : -9999;		// if my target piece is king, then it is the most rewarding move
+        }
+        const bool &reducible = i - base >= 4 && depth >= 3 && !in_check && move.Kind() != PROMOTION && c.GetPiece(move.ToX(), move.ToY()) == EMPTY;
+        c.MakeMove(move);
+        if(c.IsCheck(!c.GetTurn())) {		// the move leaves the mover's own king in check, it was never legal
+            c.UnmakeMove(move);
+            continue;
+        }
+        float child_points;
+        if(reducible) {			// late-move reduction: quiet moves far down the ordered list rarely beat alpha, try them one ply shallower first
+            unsigned short reduced_depth = depth - 2;
+            child_points = AlphaBeta(c, reduced_depth, alpha, beta, !maximizing_player, initial_turn);
+            if(maximizing_player ? child_points > alpha : child_points < beta)
+                child_points = AlphaBeta(c, --depth, alpha, beta, !maximizing_player, initial_turn), ++depth;	// it failed high after all, re-search at full depth
+        }
+        else
+            child_points = AlphaBeta(c, --depth, alpha, beta, !maximizing_player, initial_turn), ++depth;		// recursive alpha-beta algorithm
+        c.UnmakeMove(move);
+        if(maximizing_player ? child_points > points : child_points < points) {
+            points = child_points;
+            best_move = move;
+        }
+        maximizing_player ? alpha = std::max(alpha, points) : beta = std::min(beta, points);
+        if(alpha >= beta) {
+            ++thread_stats.beta_cutoffs;
+            thread_stats.first_move_cutoffs += i == base;
+            if(c.GetPiece(move.ToX(), move.ToY()) == EMPTY) {		// remember quiet moves that cause cutoffs for future ordering
+                if(!(move == killer_moves[depth][0])) {
+                    killer_moves[depth][1] = killer_moves[depth][0];
+                    killer_moves[depth][0] = move;
+                }
+                history_table[c.GetTurn()][move.FromY()*BOARD_SIZE + move.FromX()][move.ToY()*BOARD_SIZE + move.ToX()] += depth*depth;
+            }
+            break;
+        }
+    }
+    move_arena.resize(base);		// bump the arena pointer back, releasing every move of this node at once
+    if(!stop_search.load(std::memory_order_relaxed))		// results of an aborted search are incomplete and must not poison the table
+        transposition_table.Store(key, points, depth, points <= starting_alpha ? UPPER_BOUND : points >= starting_beta ? LOWER_BOUND : EXACT, best_move);
+    return points;
+}
+
+// getter method, returns the counters of the last finished root search
+SearchStats PathNode::GetSearchStats() noexcept {
+    std::lock_guard<std::mutex> guard(stats_lock);
+    return search_stats;
+}
+
+// raises the stop flag so this node's running search winds down and delivers its best move so far
+void PathNode::StopSearch() noexcept {
+    stop_search.store(true);
+}
+
+// getter method, returns true once this node's running search has been told to stop
+bool PathNode::SearchStopped() noexcept {
+    return stop_search.load();
+}
+
+// empties the shared transposition table so benchmark runs start cold and stay comparable, must not run during a search
+void PathNode::ClearTranspositionTable() noexcept {
+    transposition_table.Clear();
+}
+
+// the background ponder worker and the node whose search it runs, at most one runs at a time
+static std::thread ponder_thread;
+static PathNode ponder_root;
+
+// starts a background search of the given position so the shared transposition table deepens while the opponent thinks,
+// every candidate reply is searched from the bot's own side so the stored entries live in the namespace the real search probes
+void PathNode::StartPondering(const Chess &c) noexcept {
+#if PONDERING
+    StopPondering();
+    ponder_root.stop_search.store(false);
+    ponder_root.search_deadline.store(std::chrono::steady_clock::now() + std::chrono::hours(24));		// runs until the opponent moves
+    ponder_thread = std::thread([c]() {
+        Chess copy = c;
+        const auto &replies = copy.AllMoves();					// the opponent's candidate replies
+        const Position &root_position = copy.SavePosition();
+        for(unsigned short depth=1;depth<=MAX_SEARCH_DEPTH && !ponder_root.stop_search.load();++depth)
+            for(const auto &reply : replies) {
+                copy.MakeMove(reply);
+                auto root_moves = copy.AllMoves();
+                if(!root_moves.empty()) {						// the reply position is searched exactly like the real search will see it
+                    float best_score;
+                    ponder_root.SearchRoot(copy, root_moves, depth, best_score);
+                }
+                copy.RestorePosition(root_position);
+                if(ponder_root.stop_search.load())
+                    break;
+            }
+    });
+#endif
+}
+
+// stops the background ponder search and waits for its worker to finish
+void PathNode::StopPondering() noexcept {
+    if(ponder_thread.joinable()) {		// only interrupt a search when a ponder worker is actually running
+        ponder_root.stop_search.store(true);
+        ponder_thread.join();
+    }
+}
+
+// searches the given root moves to the given depth in the order given and returns the best one
+Move PathNode::SearchRoot(Chess &c, const std::vector<Move> &root_moves, unsigned short depth, float &best_score) noexcept {
+    const bool &root_turn = c.GetTurn();
+    std::vector<Move> ideal_moves;
+    float max_move_score = -9999;
+#if PARALLEL_SEARCH
+    std::atomic<unsigned short> next_move(0);
+    std::atomic<float> shared_alpha(-10000);
+    std::mutex best_lock;
+    const auto &Worker = [&]() {
+        Chess copy = c;								// every worker searches its own copy of the position
+        const Position &root_position = copy.SavePosition();	// restored after each root move instead of undoing it
+        move_arena.reserve((MAX_SEARCH_DEPTH+1) * 64);		// grown once, every later search on this thread reuses the storage
+        unsigned short worker_depth = depth;
+        while(true) {
+            const unsigned short &index = next_move.fetch_add(1);		// claim the next unsearched root move
+            if(index >= root_moves.size())
+                break;
+            copy.MakeMove(root_moves[index]);
+            const float &move_score = AlphaBeta(copy, worker_depth, shared_alpha.load(), 10000, false, root_turn);		// on this node, so every worker obeys this search's time control
+            copy.RestorePosition(root_position);
+            std::lock_guard<std::mutex> guard(best_lock);
+            if(move_score > max_move_score) {
+                max_move_score = move_score;
+                ideal_moves.clear();
+                ideal_moves.emplace_back(root_moves[index]);			// add the most rewarding move to the list
+            }
+            else if(move_score == max_move_score)
+                ideal_moves.emplace_back(root_moves[index]);
+            float alpha = shared_alpha.load();		// share the raised alpha bound with the other workers
+            while(move_score > alpha && !shared_alpha.compare_exchange_weak(alpha, move_score));
+        }
+        MergeSearchStats();
+    };
+    std::vector<std::thread> workers;
+    for(unsigned short i=0;i<SEARCH_THREADS;++i)
+        workers.emplace_back(Worker);
+    for(auto &worker : workers)
+        worker.join();
+#else
+    move_arena.reserve((MAX_SEARCH_DEPTH+1) * 64);		// grown once, every later search on this thread reuses the storage
+    const Position &root_position = c.SavePosition();		// restored after each root move instead of undoing it
+    for(const auto &move : root_moves) {
+        c.MakeMove(move);
+        const float &move_score = AlphaBeta(c, depth, -10000, 10000, false, root_turn);
+        if(move_score > max_move_score) {
+            max_move_score = move_score;
+            ideal_moves.clear();
+            ideal_moves.emplace_back(move);			// add the most rewarding move to the list
+        }
+        else if(move_score == max_move_score)
+            ideal_moves.emplace_back(move);
+        c.RestorePosition(root_position);
+    }
+    MergeSearchStats();
+#endif
+    best_score = max_move_score;
+    return ideal_moves[c.GetRandomGenerator().Below(ideal_moves.size())];
+}
+
+// the main function which returns the optimal move calculated by the alpha-beta algorithm at a fixed depth
+Move PathNode::AlphaBetaRoot(Chess &c, unsigned short &difficulty) noexcept {
+    const auto &root_moves = c.AllMoves();
+    if(root_moves.empty())
+        return Move();							// mate or stalemate, the null move tells the caller there is nothing to search
+    for(const auto &move : root_moves)
+        if(c.GetPiece(move.ToX(), move.ToY()) == W_KING - 7*c.GetTurn())
+            return move;							// if my target piece is king, then this move is a game winner so return this move
+    StopPondering();							// the ponder worker competes for the cores and the table, it must not outlive this point
+    AgeHistoryTable();
+    stop_search.store(false);
+    search_deadline.store(std::chrono::steady_clock::now() + std::chrono::hours(24));		// fixed-depth searches run to completion
+    {
+        std::lock_guard<std::mutex> guard(stats_lock);		// workers of concurrently running games may be merging right now
+        search_stats = SearchStats();
+    }
+    const auto &search_start = std::chrono::steady_clock::now();
+    float best_score;
+    const Move &best_move = SearchRoot(c, root_moves, difficulty, best_score);
+    std::lock_guard<std::mutex> guard(stats_lock);
+    search_stats.max_depth = difficulty;
+    search_stats.elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - search_start).count();
+    return best_move;
+}
+
+// searches depth 1, 2, 3... until the time budget runs out and returns the best move of the last fully completed iteration
+Move PathNode::IterativeDeepening(Chess &c, const unsigned short &budget_ms) noexcept {
+    auto root_moves = c.AllMoves();
+    if(root_moves.empty())
+        return Move();							// mate or stalemate, the null move tells the caller there is nothing to search
+    for(const auto &move : root_moves)
+        if(c.GetPiece(move.ToX(), move.ToY()) == W_KING - 7*c.GetTurn())
+            return move;							// if my target piece is king, then this move is a game winner so return this move
+    StopPondering();							// the ponder worker competes for the cores and the table, it must not outlive this point
+    AgeHistoryTable();
+    stop_search.store(false);
+    if(budget_ms)
+        search_deadline.store(std::chrono::steady_clock::now() + std::chrono::milliseconds(budget_ms));
+    else
+        search_deadline.store(std::chrono::steady_clock::now() + std::chrono::hours(24));		// a zero budget searches until "StopSearch", used by "go infinite"
+    {
+        std::lock_guard<std::mutex> guard(stats_lock);		// workers of concurrently running games may be merging right now
+        search_stats = SearchStats();
+    }
+    const auto &search_start = std::chrono::steady_clock::now();
+    Move best_move = root_moves[0];
+    unsigned short completed_depth = 0;
+    for(unsigned short depth=1;depth<=MAX_SEARCH_DEPTH;++depth) {
+        float best_score;
+        const Move &iteration_move = SearchRoot(c, root_moves, depth, best_score);
+        if(stop_search.load())
+            break;									// the iteration was cut short, its result is unreliable so keep the previous one
+        completed_depth = depth;
+        best_move = iteration_move;
+        const auto &found = std::find(root_moves.begin(), root_moves.end(), best_move);
+        std::rotate(root_moves.begin(), found, found+1);		// search the best move of this iteration first at the next depth
+        if(best_score >= 9999 || best_score <= -9999)
+            break;									// a forced mate was found, deeper searches cannot improve on it
+    }
+    std::lock_guard<std::mutex> guard(stats_lock);
+    search_stats.max_depth = completed_depth;
+    search_stats.elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - search_start).count();
+    return best_move;
+}
@@ -0,0 +1,42 @@
+#include "chess.h"
+#include <iostream>
+
+// perft harness, counts leaf nodes of the legal move tree to validate and benchmark move generation and make/unmake
+
+// reference leaf counts of the starting position, perft(1) through perft(6)
+static const unsigned long long STARTING_BOARD_COUNTS[6] = {20, 400, 8902, 197281, 4865609, 119060324};
+
+// counts the leaf nodes of the legal move tree the given number of plies deep from the current position
+unsigned long long Chess::Perft(const unsigned short &depth) noexcept {
+    if(!depth)
+        return 1;
+    const auto &all_moves = AllMoves();
+    if(depth == 1)
+        return all_moves.size();		// the generated moves are already fully legal, the last ply does not need to be walked
+    unsigned long long nodes = 0;
+    for(const auto &move : all_moves) {
+        MakeMove(move);
+        nodes += Perft(depth - 1);
+        UnmakeMove(move);
+    }
+    return nodes;
+}
+
+// runs perft on the starting position for every depth up to the given one, verifies the known reference counts and reports the speed
+void Chess::RunPerft(const unsigned short &depth) noexcept {
+    Chess c("White", 0, "Black", 0);
+    for(unsigned short d=1;d<=depth;++d) {
+        const auto &start = std::chrono::steady_clock::now();
+        const unsigned long long &nodes = c.Perft(d);
+        const auto &elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "perft(" << d << ") = " << nodes;
+        if(d <= 6 && nodes != STARTING_BOARD_COUNTS[d-1])
+            std::cout << " FAILED, expected " << STARTING_BOARD_COUNTS[d-1];
+        else if(d <= 6)
+            std::cout << " ok";
+        std::cout << ", " << elapsed/1000.0 << " ms";
+        if(elapsed)
+            std::cout << " (" << nodes*1000000/elapsed << " nodes/second)";
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,47 @@
+#include "chess.h"
+
+// random generator class implementation
+
+// rotates the given value left by "k" bits
+static unsigned long long RotateLeft(const unsigned long long &x, const short &k) noexcept {
+    return (x << k) | (x >> (64 - k));
+}
+
+// random generator constructor, a seed of 0 draws a fresh unique seed
+RandomGenerator::RandomGenerator(const unsigned long long &seed) noexcept {
+    Seed(seed);
+}
+
+// expands the given seed into the four state words with splitmix64, the same scheme the zobrist keys use
+void RandomGenerator::Seed(unsigned long long new_seed) noexcept {
+    static std::atomic<unsigned long long> sequence(0);		// makes clock-drawn seeds unique even across concurrent constructions
+    if(!new_seed)
+        new_seed = std::chrono::steady_clock::now().time_since_epoch().count() + (++sequence) * 0x9e3779b97f4a7c15ULL;
+    seed = new_seed;
+    for(short i=0;i<4;++i) {
+        unsigned long long z = (new_seed += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        state[i] = z ^ (z >> 31);
+    }
+}
+
+// getter method, returns the seed this stream started from
+unsigned long long RandomGenerator::GetSeed() const noexcept {
+    return seed;
+}
+
+// returns the next 64 random bits of the stream (xoshiro256**)
+unsigned long long RandomGenerator::Next() noexcept {
+    const unsigned long long &result = RotateLeft(state[1] * 5, 7) * 9;
+    const unsigned long long &t = state[1] << 17;
+    state[2] ^= state[0], state[3] ^= state[1], state[1] ^= state[2], state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = RotateLeft(state[3], 45);
+    return result;
+}
+
+// returns an evenly distributed number in [0, "bound"), a multiply-shift draw with none of the modulo bias of rand()
+unsigned short RandomGenerator::Below(const unsigned short &bound) noexcept {
+    return ((Next() >> 32) * bound) >> 32;
+}
@@ -0,0 +1,57 @@
+#include "chess.h"
+#include <algorithm>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <iostream>
+#endif
+
+// renderer class implementation
+
+// renderer constructor, both buffers start blank to match a freshly cleared console
+Renderer::Renderer() noexcept : front_buffer(FRAME_WIDTH*FRAME_HEIGHT, ' '), back_buffer(FRAME_WIDTH*FRAME_HEIGHT, ' ') {	}
+
+// blanks the frame being composed
+void Renderer::Clear() noexcept {
+    std::fill(back_buffer.begin(), back_buffer.end(), ' ');
+}
+
+// forgets what the console shows, forcing the next flush to redraw everything, must be called after the screen is cleared externally
+void Renderer::Invalidate() noexcept {
+    std::fill(front_buffer.begin(), front_buffer.end(), ' ');
+}
+
+// writes text into the frame being composed at the given cell coordinates
+void Renderer::Write(const short &x, const short &y, const std::string &text) noexcept {
+    for(size_t i=0;i<text.length() && x+i < FRAME_WIDTH;++i)
+        back_buffer[y*FRAME_WIDTH + x + i] = text[i];
+}
+
+// sends the composed frame to the console, flushing only the rows that changed with a single WriteConsoleOutput call
+void Renderer::Present() noexcept {
+    short first_dirty = FRAME_HEIGHT, last_dirty = -1;
+    for(short y=0;y<FRAME_HEIGHT;++y)
+        if(!std::equal(back_buffer.begin() + y*FRAME_WIDTH, back_buffer.begin() + (y+1)*FRAME_WIDTH, front_buffer.begin() + y*FRAME_WIDTH)) {
+            first_dirty = std::min(first_dirty, y);
+            last_dirty = y;
+        }
+    if(last_dirty < first_dirty)
+        return;			// the frame is identical to what is already on screen
+#ifdef _WIN32
+    std::vector<CHAR_INFO> cells((last_dirty - first_dirty + 1) * FRAME_WIDTH);
+    for(size_t i=0;i<cells.size();++i) {
+        cells[i].Char.AsciiChar = back_buffer[first_dirty*FRAME_WIDTH + i];
+        cells[i].Attributes = 7;		// default white-on-black text
+    }
+    const COORD &size = {FRAME_WIDTH, static_cast<short>(last_dirty - first_dirty + 1)}, &origin = {0, 0};
+    SMALL_RECT region = {0, first_dirty, FRAME_WIDTH-1, last_dirty};
+    WriteConsoleOutputA(GetStdHandle(STD_OUTPUT_HANDLE), cells.data(), size, origin, &region);
+#else
+    for(short y=first_dirty;y<=last_dirty;++y) {		// no console API to batch the rows, write each dirty one behind a cursor move
+        MoveCursorToXY(0, y);
+        std::cout.write(&back_buffer[y*FRAME_WIDTH], FRAME_WIDTH);
+    }
+    std::cout.flush();
+#endif
+    std::copy(back_buffer.begin() + first_dirty*FRAME_WIDTH, back_buffer.begin() + (last_dirty+1)*FRAME_WIDTH, front_buffer.begin() + first_dirty*FRAME_WIDTH);
+}
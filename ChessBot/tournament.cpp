@@ -0,0 +1,41 @@
+#include "chess.h"
+#include <iostream>
+#include <thread>
+
+// concurrent tournament scheduler, plays independent bot vs bot games across a pool of worker threads in one process
+
+// plays the given number of games across the given number of workers and prints a single summary at the end
+void Chess::PlayTournament(const unsigned short &number_of_games, const unsigned short &workers) noexcept {
+    std::atomic<unsigned short> next_game(0);		// the shared game queue, games are identical units of work so handing out indices balances the load
+    std::atomic<unsigned short> white_wins(0), black_wins(0), draws(0);
+    std::atomic<unsigned long long> total_moves(0);
+    const auto &start = std::chrono::steady_clock::now();
+    const auto &PlayGames = [&]() {
+        Chess c("White bot", WHITE_BOT_DIFFICULTY, "Black bot", BLACK_BOT_DIFFICULTY);		// each worker owns its own game
+        while(next_game.fetch_add(1) < number_of_games) {
+            unsigned short moves = 0;
+            Endgame end_game;
+            do
+                end_game = c.PlayBotMove(), ++moves;
+            while(end_game == ONGOING);
+            end_game == CHECKMATE ? ++(c.whites_turn ? black_wins : white_wins) : ++draws;		// after the mating move it is the loser's turn
+            if(RECORD_GAMES) {
+                c.SaveGameRecord(end_game);
+                c.SavePGN(end_game);
+            }
+            total_moves += moves;
+            c.Reset(false);
+        }
+    };
+    std::vector<std::thread> pool;
+    for(unsigned short worker=1;worker<workers;++worker)
+        pool.emplace_back(PlayGames);
+    PlayGames();
+    for(auto &worker : pool)
+        worker.join();
+    const auto &total_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Played " << number_of_games << " games on " << workers << " workers in " << total_time/1000.0 << " seconds" << std::endl;
+    std::cout << "White wins: " << white_wins << ", black wins: " << black_wins << ", draws: " << draws << std::endl;
+    std::cout << "Moves played: " << total_moves << " (" << total_moves/(float)number_of_games << " per game, ";
+    std::cout << (total_moves ? total_time/(float)total_moves : 0) << " ms per move)" << std::endl;
+}
@@ -0,0 +1,41 @@
+#include "chess.h"
+#include <algorithm>
+
+// transposition table class implementation
+
+// transposition table constructor, allocates the largest power-of-two number of entries fitting in the given number of megabytes
+TranspositionTable::TranspositionTable(const unsigned short &megabytes) noexcept {
+    unsigned long long count = 1;
+    while(count * 2 * sizeof(TTEntry) <= megabytes * 1048576ULL)
+        count *= 2;
+    entries.resize(count);
+    mask = count - 1;
+}
+
+// copies the stored entry for the given position key into "entry" and returns true, or returns false on a miss
+bool TranspositionTable::Probe(const unsigned long long &key, TTEntry &entry) const noexcept {
+    std::lock_guard<std::mutex> guard(locks[key & 63]);
+    const TTEntry &stored = entries[key & mask];
+    if(!stored.depth || stored.key != key)
+        return false;
+    entry = stored;
+    return true;
+}
+
+// stores the given search result, an existing entry is replaced when the new search is at least as deep or the keys match
+void TranspositionTable::Store(const unsigned long long &key, const float &score, const unsigned short &depth, const char &bound, const Move &best_move) noexcept {
+    std::lock_guard<std::mutex> guard(locks[key & 63]);
+    TTEntry &entry = entries[key & mask];
+    if(depth >= entry.depth || entry.key == key) {
+        entry.key = key;
+        entry.score = score;
+        entry.depth = depth;
+        entry.bound = bound;
+        entry.best_move = best_move;
+    }
+}
+
+// empties the table, every stored position is forgotten, must not run while a search is in flight
+void TranspositionTable::Clear() noexcept {
+    std::fill(entries.begin(), entries.end(), TTEntry());
+}
@@ -0,0 +1,118 @@
+#include "chess.h"
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <thread>
+
+// UCI protocol server, lets GUIs and analysis drivers pipe the engine over stdin/stdout instead of scraping the console game
+
+static const std::string STARTING_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+// the worker thread running the current search and the node it searches on, kept off the command loop so "stop" is honored immediately
+static std::thread search_thread;
+static PathNode search_root;
+
+// waits for the running search to deliver its best move, if one is in flight
+static void JoinSearch() noexcept {
+    if(search_thread.joinable())
+        search_thread.join();
+}
+
+// applies one move given in coordinate notation like "e2e4" or "e7e8q" to the position, illegal moves are ignored
+static void ApplyMoveText(Chess &c, const std::string &text) noexcept {
+    if(text.length() < 4)
+        return;
+    const auto &all_moves = c.AllMoves();
+    const auto &found = std::find(all_moves.begin(), all_moves.end(), Move(text[0]-'a', '8'-text[1], text[2]-'a', '8'-text[3]));
+    if(found == all_moves.end())
+        return;
+    char promotion = EMPTY;
+    switch(text.length() > 4 ? tolower(text[4]) : ' ') {
+        case 'q':	promotion = W_QUEEN;	break;
+        case 'b':	promotion = W_BISHOP;	break;
+        case 'n':	promotion = W_KNIGHT;	break;
+        case 'r':	promotion = W_ROOK;
+    }
+    c.MakeMove(*found, c.GetTurn() ? promotion : static_cast<char>(-promotion));
+}
+
+// handles the "position" command: an optional FEN or the starting position, followed by an optional list of moves
+static void SetUciPosition(Chess &c, std::istringstream &fields) noexcept {
+    std::string token;
+    fields >> token;
+    if(token == "startpos")
+        c.SetPosition(STARTING_FEN);
+    else if(token == "fen") {
+        std::string fen, field;
+        for(short i=0;i<6 && fields >> field;++i)
+            fen += (i ? " " : "") + field;
+        c.SetPosition(fen);
+    }
+    if(fields >> token && token == "moves")
+        while(fields >> token)
+            ApplyMoveText(c, token);
+}
+
+// starts the requested search on the worker thread, a fixed depth takes precedence over a time budget
+static void StartSearch(Chess &c, const unsigned short &depth, const unsigned short &movetime, const bool &infinite) noexcept {
+    JoinSearch();
+    search_thread = std::thread([&c, depth, movetime, infinite]() {
+        unsigned short fixed_depth = depth;
+        const Move &best_move = depth ? search_root.AlphaBetaRoot(c, fixed_depth) : search_root.IterativeDeepening(c, infinite ? 0 : movetime);
+        const SearchStats &stats = PathNode::GetSearchStats();
+        std::cout << "info depth " << stats.max_depth << " nodes " << stats.nodes << " time " << stats.elapsed_ms
+                  << " nps " << (stats.elapsed_ms ? 1000*stats.nodes/stats.elapsed_ms : stats.nodes) << std::endl;
+        while(infinite && !search_root.SearchStopped())
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));		// "go infinite" must never answer before "stop" arrives
+        std::string text = best_move.data ? best_move.ToText() : "0000";		// the null move means the position has no legal moves
+        if(best_move.Kind() == PROMOTION)
+            text += 'q';		// the search always promotes to a queen
+        std::cout << "bestmove " << text << std::endl;
+    });
+}
+
+// the UCI command loop, reads commands from stdin until "quit" or the input closes
+void Chess::RunUci() noexcept {
+    Chess c("White", WHITE_BOT_DIFFICULTY, "Black", BLACK_BOT_DIFFICULTY);
+    std::string line;
+    while(std::getline(std::cin, line)) {
+        std::istringstream fields(line);
+        std::string command;
+        fields >> command;
+        if(command == "uci")
+            std::cout << "id name ChessBot" << std::endl << "id author the ChessBot developers" << std::endl << "uciok" << std::endl;
+        else if(command == "isready")
+            std::cout << "readyok" << std::endl;
+        else if(command == "ucinewgame") {
+            JoinSearch();
+            c.Reset(false);
+            PathNode::ClearTranspositionTable();
+        }
+        else if(command == "position") {
+            JoinSearch();
+            SetUciPosition(c, fields);
+        }
+        else if(command == "go") {
+            unsigned short depth = 0, movetime = MOVE_TIME_MS ? MOVE_TIME_MS : 1000;
+            bool infinite = false;
+            std::string token;
+            unsigned long milliseconds;
+            while(fields >> token)
+                if(token == "depth" && fields >> depth)
+                    depth = std::min(depth, static_cast<unsigned short>(MAX_SEARCH_DEPTH));		// the killer move table is sized for MAX_SEARCH_DEPTH plies
+                else if(token == "movetime" && fields >> milliseconds)
+                    movetime = std::min(milliseconds, 65535ul);
+                else if(token == "infinite")
+                    infinite = true;
+            StartSearch(c, depth, movetime, infinite);
+        }
+        else if(command == "stop") {
+            search_root.StopSearch();
+            JoinSearch();
+        }
+        else if(command == "quit")
+            break;
+    }
+    search_root.StopSearch();
+    JoinSearch();
+}